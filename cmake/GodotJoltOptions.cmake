@@ -18,6 +18,11 @@ else()
 	set(GDJ_USE_MIMALLOC FALSE)
 endif()
 
+set(GDJ_TRACK_ALLOCATIONS FALSE
+	CACHE BOOL
+	"Track memory allocations made by Jolt and attribute them to different categories."
+)
+
 set(GDJ_INTERPROCEDURAL_OPTIMIZATION TRUE
 	CACHE BOOL
 	"Enable interprocedural optimizations for any optimized builds."
@@ -53,3 +58,8 @@ set(GDJ_INSTALL_DEBUG_SYMBOLS FALSE
 	CACHE BOOL
 	"Install debug symbols along with the binaries."
 )
+
+set(GDJ_GODOT_EXECUTABLE ""
+	CACHE FILEPATH
+	"Godot executable used to run the benchmarks and checks in the examples project."
+)
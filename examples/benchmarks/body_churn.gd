@@ -0,0 +1,74 @@
+# Measures the cost of spawning and freeing a large number of short-lived bodies every frame, like
+# projectiles or debris, both with and without body pooling enabled for the space.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/body_churn.gd
+
+extends SceneTree
+
+const POOL_SIZES: Array[int] = [0, 1024]
+const BODIES_PER_FRAME := 200
+const BODY_LIFETIME := 5
+const FRAME_COUNT := 300
+
+func _initialize() -> void:
+	for pool_size in POOL_SIZES:
+		await _run(pool_size)
+
+	quit()
+
+func _run(pool_size: int) -> void:
+	var server := PhysicsServer3D as Object
+	var space := root.get_world_3d().space
+
+	server.call("space_set_max_pooled_bodies", space, pool_size)
+
+	var level := Node3D.new()
+	root.add_child(level)
+
+	var shape := SphereShape3D.new()
+	shape.radius = 0.1
+
+	var generations: Array[Array] = []
+	var frame_times := PackedInt64Array()
+
+	for frame in FRAME_COUNT:
+		var start := Time.get_ticks_usec()
+
+		if generations.size() == BODY_LIFETIME:
+			for body: Node in generations.pop_front():
+				body.free()
+
+		var generation: Array[Node] = []
+
+		for i in BODIES_PER_FRAME:
+			var collision_shape := CollisionShape3D.new()
+			collision_shape.shape = shape
+
+			var body := RigidBody3D.new()
+			body.position = Vector3(i % 20, 1 + frame % 10, i / 20)
+			body.linear_velocity = Vector3(0, 0, 50)
+			body.add_child(collision_shape)
+
+			level.add_child(body)
+			generation.append(body)
+
+		generations.append(generation)
+
+		await physics_frame
+
+		frame_times.append(Time.get_ticks_usec() - start)
+
+	frame_times.sort()
+
+	print("Pool size: %d" % pool_size)
+	print("Bodies per frame: %d" % BODIES_PER_FRAME)
+	print("p50: %.2f ms" % (frame_times[frame_times.size() / 2] / 1000.0))
+	print("p99: %.2f ms" % (frame_times[frame_times.size() * 99 / 100] / 1000.0))
+	print("max: %.2f ms" % (frame_times[-1] / 1000.0))
+	print()
+
+	level.free()
+
+	server.call("space_set_max_pooled_bodies", space, 0)
+
+	await physics_frame
@@ -0,0 +1,105 @@
+# Compares the cost of finding the bodies near a point using the broad-phase-only queries against
+# doing the same through `intersect_shape`, with a grid of dynamic bodies spread across the level.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/broad_phase_queries.gd
+
+extends SceneTree
+
+const GRID_SIZE := 100
+const BODY_SPACING := 2.0
+const QUERY_COUNT := 2000
+const QUERY_RADIUS := 10.0
+
+func _initialize() -> void:
+	var server := PhysicsServer3D as Object
+	var space := root.get_world_3d().space
+	var space_state := root.get_world_3d().direct_space_state
+
+	var level := Node3D.new()
+	root.add_child(level)
+
+	var shape := SphereShape3D.new()
+	shape.radius = 0.5
+
+	for row in GRID_SIZE:
+		for column in GRID_SIZE:
+			var collision_shape := CollisionShape3D.new()
+			collision_shape.shape = shape
+
+			var body := RigidBody3D.new()
+			body.gravity_scale = 0.0
+			body.position = Vector3(column, 0, row) * BODY_SPACING
+			body.add_child(collision_shape)
+
+			level.add_child(body)
+
+	await physics_frame
+
+	var extent := GRID_SIZE * BODY_SPACING
+	var rng := RandomNumberGenerator.new()
+	var centers := PackedVector3Array()
+
+	rng.seed = 0
+	centers.resize(QUERY_COUNT)
+
+	for i in QUERY_COUNT:
+		centers[i] = Vector3(rng.randf_range(0, extent), 0, rng.randf_range(0, extent))
+
+	var query_shape := SphereShape3D.new()
+	query_shape.radius = QUERY_RADIUS
+
+	var query := PhysicsShapeQueryParameters3D.new()
+	query.shape = query_shape
+
+	var shape_hits := 0
+	var shape_start := Time.get_ticks_usec()
+
+	for center in centers:
+		query.transform = Transform3D(Basis(), center)
+		shape_hits += space_state.intersect_shape(query, GRID_SIZE * GRID_SIZE).size()
+
+	var shape_time := Time.get_ticks_usec() - shape_start
+
+	var sphere_hits := 0
+	var sphere_start := Time.get_ticks_usec()
+
+	for center in centers:
+		var hits: PackedInt64Array = server.call(
+			"space_intersect_sphere",
+			space,
+			center,
+			QUERY_RADIUS,
+			0xFFFFFFFF,
+			true,
+			false
+		)
+
+		sphere_hits += hits.size() / 2
+
+	var sphere_time := Time.get_ticks_usec() - sphere_start
+
+	var aabb_hits := 0
+	var aabb_start := Time.get_ticks_usec()
+
+	for center in centers:
+		var aabb := AABB(center - Vector3.ONE * QUERY_RADIUS, Vector3.ONE * QUERY_RADIUS * 2.0)
+		var hits: PackedInt64Array = server.call(
+			"space_intersect_aabb",
+			space,
+			aabb,
+			0xFFFFFFFF,
+			true,
+			false
+		)
+
+		aabb_hits += hits.size() / 2
+
+	var aabb_time := Time.get_ticks_usec() - aabb_start
+
+	print("Bodies: %d" % (GRID_SIZE * GRID_SIZE))
+	print("Queries: %d" % QUERY_COUNT)
+	print("intersect_shape: %.2f ms (%d hits)" % [shape_time / 1000.0, shape_hits])
+	print("space_intersect_sphere: %.2f ms (%d hits)" % [sphere_time / 1000.0, sphere_hits])
+	print("space_intersect_aabb: %.2f ms (%d hits)" % [aabb_time / 1000.0, aabb_hits])
+
+	quit()
@@ -0,0 +1,136 @@
+# Queries a space from worker threads while the main thread keeps spawning and freeing bodies and
+# stepping the space underneath them. Every ray is cast down onto a floor that is never freed, so
+# any ray that misses it points to a query having observed the space mid-modification. The query
+# throughput is reported for each number of worker tasks, and the process exits with a non-zero
+# exit code if any inconsistencies were found, which fails the `check_concurrent_queries` target.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/concurrent_queries.gd
+
+extends SceneTree
+
+const TASK_COUNTS: Array[int] = [1, 4, 16]
+const QUERIES_PER_TASK := 500
+const BODIES_PER_FRAME := 100
+const BODY_LIFETIME := 3
+const FRAME_COUNT := 120
+const FLOOR_SIZE := 50.0
+
+var space_state: PhysicsDirectSpaceState3D
+var query_shape := SphereShape3D.new()
+var counter_mutex := Mutex.new()
+var ray_count := 0
+var ray_misses := 0
+var shape_count := 0
+
+func _initialize() -> void:
+	space_state = root.get_world_3d().direct_space_state
+	query_shape.radius = 1.0
+
+	var floor_shape := BoxShape3D.new()
+	floor_shape.size = Vector3(FLOOR_SIZE, 1, FLOOR_SIZE)
+
+	var floor_collision_shape := CollisionShape3D.new()
+	floor_collision_shape.shape = floor_shape
+
+	var floor_body := StaticBody3D.new()
+	floor_body.position = Vector3(0, -0.5, 0)
+	floor_body.add_child(floor_collision_shape)
+
+	root.add_child(floor_body)
+
+	await physics_frame
+
+	var failed := false
+
+	for task_count in TASK_COUNTS:
+		failed = not await _run(task_count) or failed
+
+	floor_body.free()
+
+	quit(1 if failed else 0)
+
+func _run(task_count: int) -> bool:
+	var level := Node3D.new()
+	root.add_child(level)
+
+	var shape := SphereShape3D.new()
+	shape.radius = 0.25
+
+	ray_count = 0
+	ray_misses = 0
+	shape_count = 0
+
+	var generations: Array[Array] = []
+	var start := Time.get_ticks_usec()
+
+	for frame in FRAME_COUNT:
+		var group_task := WorkerThreadPool.add_group_task(_query, task_count)
+
+		if generations.size() == BODY_LIFETIME:
+			for body: Node in generations.pop_front():
+				body.free()
+
+		var generation: Array[Node] = []
+
+		for i in BODIES_PER_FRAME:
+			var collision_shape := CollisionShape3D.new()
+			collision_shape.shape = shape
+
+			var body := RigidBody3D.new()
+			body.position = Vector3(i % 10 - 5, 2 + frame % 10, i / 10 - 5)
+			body.add_child(collision_shape)
+
+			level.add_child(body)
+			generation.append(body)
+
+		generations.append(generation)
+
+		# The space is stepped while the queries are still running
+		await physics_frame
+
+		WorkerThreadPool.wait_for_group_task_completion(group_task)
+
+	var elapsed := Time.get_ticks_usec() - start
+
+	level.free()
+
+	await physics_frame
+
+	print("Tasks: %d" % task_count)
+	print("Rays: %d (%d misses)" % [ray_count, ray_misses])
+	print("Shape queries: %d" % shape_count)
+	print("Queries per second: %.0f" % ((ray_count + shape_count) / (elapsed / 1000000.0)))
+	print()
+
+	return ray_misses == 0
+
+func _query(task_index: int) -> void:
+	var rng := RandomNumberGenerator.new()
+	rng.seed = task_index
+
+	var half_size := FLOOR_SIZE * 0.5 - 1.0
+	var ray := PhysicsRayQueryParameters3D.new()
+
+	var shape_query := PhysicsShapeQueryParameters3D.new()
+	shape_query.shape = query_shape
+
+	var misses := 0
+
+	for i in QUERIES_PER_TASK:
+		var x := rng.randf_range(-half_size, half_size)
+		var z := rng.randf_range(-half_size, half_size)
+
+		ray.from = Vector3(x, 50, z)
+		ray.to = Vector3(x, -10, z)
+
+		if space_state.intersect_ray(ray).is_empty():
+			misses += 1
+
+		shape_query.transform = Transform3D(Basis(), Vector3(x, 5, z))
+		space_state.intersect_shape(shape_query)
+
+	counter_mutex.lock()
+	ray_count += QUERIES_PER_TASK
+	ray_misses += misses
+	shape_count += QUERIES_PER_TASK
+	counter_mutex.unlock()
@@ -0,0 +1,55 @@
+# Measures how long it takes to load a level consisting of a large number of static bodies, as well
+# as how long the first physics step and the first few queries take afterwards.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/level_load.gd
+
+extends SceneTree
+
+const BODY_COUNT := 40000
+const BODY_SPACING := 2.0
+const QUERY_COUNT := 1000
+
+func _initialize() -> void:
+	var level := Node3D.new()
+	var shape := BoxShape3D.new()
+	var grid_size := ceili(sqrt(BODY_COUNT))
+
+	for i in BODY_COUNT:
+		var collision_shape := CollisionShape3D.new()
+		collision_shape.shape = shape
+
+		var body := StaticBody3D.new()
+		body.position = Vector3(i % grid_size, 0, i / grid_size) * BODY_SPACING
+		body.add_child(collision_shape)
+
+		level.add_child(body)
+
+	var load_start := Time.get_ticks_usec()
+	root.add_child(level)
+	var load_time := Time.get_ticks_usec() - load_start
+
+	var step_start := Time.get_ticks_usec()
+	await physics_frame
+	var step_time := Time.get_ticks_usec() - step_start
+
+	var space_state := root.get_world_3d().direct_space_state
+	var extent := grid_size * BODY_SPACING
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	var query_start := Time.get_ticks_usec()
+
+	for i in QUERY_COUNT:
+		var x := rng.randf_range(0, extent)
+		var z := rng.randf_range(0, extent)
+		var query := PhysicsRayQueryParameters3D.create(Vector3(x, 10, z), Vector3(x, -10, z))
+		space_state.intersect_ray(query)
+
+	var query_time := Time.get_ticks_usec() - query_start
+
+	print("Bodies: %d" % BODY_COUNT)
+	print("Load: %.2f ms" % (load_time / 1000.0))
+	print("First step: %.2f ms" % (step_time / 1000.0))
+	print("First %d ray casts: %.2f ms" % [QUERY_COUNT, query_time / 1000.0])
+
+	quit()
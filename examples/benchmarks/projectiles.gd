@@ -0,0 +1,87 @@
+# Measures the cost of simulating a large number of projectiles through the batched projectile API,
+# with projectiles being fired at a static wall and respawned as they hit it.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/projectiles.gd
+
+extends SceneTree
+
+const PROJECTILE_COUNTS: Array[int] = [2000, 20000]
+const PROJECTILE_SPEED := 100.0
+const PROJECTILE_LIFETIME := 2.0
+const FRAME_COUNT := 300
+
+func _initialize() -> void:
+	for projectile_count in PROJECTILE_COUNTS:
+		await _run(projectile_count)
+
+	quit()
+
+func _run(projectile_count: int) -> void:
+	var server := PhysicsServer3D as Object
+	var space := root.get_world_3d().space
+
+	var wall_shape := BoxShape3D.new()
+	wall_shape.size = Vector3(200, 200, 1)
+
+	var collision_shape := CollisionShape3D.new()
+	collision_shape.shape = wall_shape
+
+	var wall := StaticBody3D.new()
+	wall.position = Vector3(0, 0, -50)
+	wall.add_child(collision_shape)
+
+	root.add_child(wall)
+
+	await physics_frame
+
+	var total_hits := 0
+	var frame_times := PackedInt64Array()
+
+	for frame in FRAME_COUNT:
+		var alive: int = server.call("space_get_projectiles", space)["ids"].size()
+		var missing := projectile_count - alive
+
+		if missing > 0:
+			var positions := PackedVector3Array()
+			var velocities := PackedVector3Array()
+
+			positions.resize(missing)
+			velocities.resize(missing)
+
+			for i in missing:
+				positions[i] = Vector3(randf_range(-50, 50), randf_range(-50, 50), 0)
+				velocities[i] = Vector3(0, 0, -PROJECTILE_SPEED)
+
+			server.call(
+				"space_add_projectiles",
+				space,
+				positions,
+				velocities,
+				0.0,
+				0.0,
+				PROJECTILE_LIFETIME,
+				1
+			)
+
+		var start := Time.get_ticks_usec()
+
+		await physics_frame
+
+		frame_times.append(Time.get_ticks_usec() - start)
+
+		total_hits += server.call("space_get_projectile_hits", space)["ids"].size()
+
+	frame_times.sort()
+
+	print("Projectiles: %d" % projectile_count)
+	print("Hits: %d" % total_hits)
+	print("p50: %.2f ms" % (frame_times[frame_times.size() / 2] / 1000.0))
+	print("p99: %.2f ms" % (frame_times[frame_times.size() * 99 / 100] / 1000.0))
+	print("max: %.2f ms" % (frame_times[-1] / 1000.0))
+	print()
+
+	server.call("space_clear_projectiles", space)
+
+	wall.free()
+
+	await physics_frame
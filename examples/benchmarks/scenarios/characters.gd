@@ -0,0 +1,54 @@
+# A large number of characters moving around with `move_and_slide`, which stresses the shape casts
+# and contact queries used by `CharacterBody3D`.
+
+extends "scenario.gd"
+
+const CHARACTER_COUNT := 1000
+const FIELD_SIZE := 100.0
+const WALL_COUNT := 200
+const SPEED := 5.0
+
+var _characters: Array[CharacterBody3D] = []
+
+func build() -> void:
+	add_ground(FIELD_SIZE * 2)
+
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	var wall_shape := BoxShape3D.new()
+	wall_shape.size = Vector3(4, 2, 0.5)
+
+	for i in WALL_COUNT:
+		var position := Vector3(
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2),
+			1,
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2)
+		)
+
+		add_static_body(wall_shape, position).rotate_y(rng.randf() * TAU)
+
+	var character_shape := CapsuleShape3D.new()
+
+	for i in CHARACTER_COUNT:
+		var character := CharacterBody3D.new()
+		character.add_child(_create_collision_shape(character_shape))
+		character.position = Vector3(
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2),
+			1,
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2)
+		)
+
+		var direction := Vector3.FORWARD.rotated(Vector3.UP, rng.randf() * TAU)
+		character.velocity = direction * SPEED
+
+		add_child(character)
+		_characters.append(character)
+
+func _physics_process(delta: float) -> void:
+	for character in _characters:
+		character.velocity.y -= 9.8 * delta
+		character.move_and_slide()
+
+		if character.is_on_wall():
+			character.velocity = character.velocity.bounce(character.get_wall_normal())
@@ -0,0 +1,28 @@
+# Pieces of cloth draped over static boxes, which stresses the soft body simulation.
+
+extends "scenario.gd"
+
+const CLOTH_COUNT := 16
+const CLOTH_SUBDIVISIONS := 31
+const CLOTH_SPACING := 6.0
+
+func build() -> void:
+	add_ground(100)
+
+	var mesh := PlaneMesh.new()
+	mesh.size = Vector2(4, 4)
+	mesh.subdivide_width = CLOTH_SUBDIVISIONS
+	mesh.subdivide_depth = CLOTH_SUBDIVISIONS
+
+	var box_shape := BoxShape3D.new()
+	var grid_size := ceili(sqrt(CLOTH_COUNT))
+
+	for i in CLOTH_COUNT:
+		var position := Vector3(i % grid_size, 0, i / grid_size) * CLOTH_SPACING
+
+		add_static_body(box_shape, position + Vector3(0, 0.5, 0))
+
+		var cloth := SoftBody3D.new()
+		cloth.mesh = mesh
+		cloth.position = position + Vector3(0, 2, 0)
+		add_child(cloth)
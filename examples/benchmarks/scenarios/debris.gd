@@ -0,0 +1,24 @@
+# A large number of small bodies dropped onto the ground, which stresses the broad-phase and the
+# handling of many small islands.
+
+extends "scenario.gd"
+
+const BODY_COUNT := 10000
+const FIELD_SIZE := 100.0
+
+func build() -> void:
+	add_ground(FIELD_SIZE * 2)
+
+	var shapes: Array[Shape3D] = [BoxShape3D.new(), SphereShape3D.new(), CapsuleShape3D.new()]
+
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in BODY_COUNT:
+		var position := Vector3(
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2),
+			rng.randf_range(1, 20),
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2)
+		)
+
+		add_rigid_body(shapes[i % shapes.size()], position)
@@ -0,0 +1,35 @@
+# Bodies dropped onto a large height map, which stresses the height map collision paths.
+
+extends "scenario.gd"
+
+const MAP_RESOLUTION := 512
+const BODY_COUNT := 2000
+
+func build() -> void:
+	var heights := PackedFloat32Array()
+	heights.resize(MAP_RESOLUTION * MAP_RESOLUTION)
+
+	for z in MAP_RESOLUTION:
+		for x in MAP_RESOLUTION:
+			heights[z * MAP_RESOLUTION + x] = sin(x * 0.1) * cos(z * 0.1) * 3
+
+	var terrain_shape := HeightMapShape3D.new()
+	terrain_shape.map_width = MAP_RESOLUTION
+	terrain_shape.map_depth = MAP_RESOLUTION
+	terrain_shape.map_data = heights
+
+	add_static_body(terrain_shape, Vector3.ZERO)
+
+	var shape := BoxShape3D.new()
+	var extent := MAP_RESOLUTION / 2.0 - 1
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in BODY_COUNT:
+		var position := Vector3(
+			rng.randf_range(-extent, extent),
+			rng.randf_range(5, 20),
+			rng.randf_range(-extent, extent)
+		)
+
+		add_rigid_body(shape, position)
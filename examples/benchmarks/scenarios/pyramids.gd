@@ -0,0 +1,20 @@
+# Stacks of boxes arranged as pyramids, which stresses the solver with large islands.
+
+extends "scenario.gd"
+
+const PYRAMID_COUNT := 10
+const PYRAMID_SIZE := 20
+const PYRAMID_SPACING := 30.0
+
+func build() -> void:
+	add_ground(PYRAMID_COUNT * PYRAMID_SPACING * 2)
+
+	var shape := BoxShape3D.new()
+
+	for pyramid in PYRAMID_COUNT:
+		var offset := (pyramid - PYRAMID_COUNT / 2.0) * PYRAMID_SPACING
+
+		for row in PYRAMID_SIZE:
+			for column in PYRAMID_SIZE - row:
+				var x := column - (PYRAMID_SIZE - row) / 2.0 + 0.5
+				add_rigid_body(shape, Vector3(x * 1.02, row + 0.5, offset))
@@ -0,0 +1,51 @@
+# Piles of jointed ragdolls, which stresses the solver with many constraints.
+
+extends "scenario.gd"
+
+const RAGDOLL_COUNT := 100
+const PILE_SIZE := 5
+
+# Each part is made up of its name, its parent, its position relative to the ragdoll and its length
+const PARTS := [
+	[&"pelvis", &"", Vector3(0, 1.0, 0), 0.3],
+	[&"torso", &"pelvis", Vector3(0, 1.4, 0), 0.4],
+	[&"head", &"torso", Vector3(0, 1.85, 0), 0.25],
+	[&"upper_arm_l", &"torso", Vector3(-0.45, 1.5, 0), 0.3],
+	[&"lower_arm_l", &"upper_arm_l", Vector3(-0.8, 1.5, 0), 0.3],
+	[&"upper_arm_r", &"torso", Vector3(0.45, 1.5, 0), 0.3],
+	[&"lower_arm_r", &"upper_arm_r", Vector3(0.8, 1.5, 0), 0.3],
+	[&"thigh_l", &"pelvis", Vector3(-0.15, 0.6, 0), 0.4],
+	[&"shin_l", &"thigh_l", Vector3(-0.15, 0.15, 0), 0.4],
+	[&"thigh_r", &"pelvis", Vector3(0.15, 0.6, 0), 0.4],
+	[&"shin_r", &"thigh_r", Vector3(0.15, 0.15, 0), 0.4],
+]
+
+func build() -> void:
+	add_ground(100)
+
+	for i in RAGDOLL_COUNT:
+		var column := i % PILE_SIZE
+		var layer := i / (PILE_SIZE * PILE_SIZE)
+		var row := (i / PILE_SIZE) % PILE_SIZE
+		_add_ragdoll(Vector3(column * 2.0, 0.2 + layer * 2.5, row * 1.0))
+
+func _add_ragdoll(origin: Vector3) -> void:
+	var bodies := {}
+
+	for part in PARTS:
+		var shape := CapsuleShape3D.new()
+		shape.radius = 0.1
+		shape.height = part[3]
+
+		var body := add_rigid_body(shape, origin + part[2])
+		bodies[part[0]] = body
+
+		if part[1] != &"":
+			var parent: RigidBody3D = bodies[part[1]]
+
+			var joint := ConeTwistJoint3D.new()
+			joint.position = (parent.position + body.position) / 2
+			add_child(joint)
+
+			joint.node_a = joint.get_path_to(parent)
+			joint.node_b = joint.get_path_to(body)
@@ -0,0 +1,35 @@
+# A large number of ray casts performed every physics frame against a field of static bodies, which
+# stresses the query paths.
+
+extends "scenario.gd"
+
+const RAY_COUNT := 50000
+const BODY_COUNT := 10000
+const BODY_SPACING := 2.0
+
+var _queries: Array[PhysicsRayQueryParameters3D] = []
+
+func build() -> void:
+	step_count = 60
+
+	var shape := BoxShape3D.new()
+	var grid_size := ceili(sqrt(BODY_COUNT))
+	var extent := grid_size * BODY_SPACING
+
+	for i in BODY_COUNT:
+		add_static_body(shape, Vector3(i % grid_size, 0, i / grid_size) * BODY_SPACING)
+
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in RAY_COUNT:
+		var x := rng.randf_range(0, extent)
+		var z := rng.randf_range(0, extent)
+		var query := PhysicsRayQueryParameters3D.create(Vector3(x, 10, z), Vector3(x, -10, z))
+		_queries.append(query)
+
+func _physics_process(_delta: float) -> void:
+	var space_state := get_world_3d().direct_space_state
+
+	for query in _queries:
+		space_state.intersect_ray(query)
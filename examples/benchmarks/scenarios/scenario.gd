@@ -0,0 +1,34 @@
+# Base script for the scenarios run by `suite.gd`. Each scenario builds its scene in `build`, before
+# being added to the scene tree, and is then stepped for `step_count` physics frames.
+
+extends Node3D
+
+var step_count := 300
+
+func build() -> void:
+	pass
+
+func add_ground(size: float) -> StaticBody3D:
+	var shape := BoxShape3D.new()
+	shape.size = Vector3(size, 1, size)
+
+	return add_static_body(shape, Vector3(0, -0.5, 0))
+
+func add_static_body(shape: Shape3D, position: Vector3) -> StaticBody3D:
+	var body := StaticBody3D.new()
+	body.position = position
+	body.add_child(_create_collision_shape(shape))
+	add_child(body)
+	return body
+
+func add_rigid_body(shape: Shape3D, position: Vector3) -> RigidBody3D:
+	var body := RigidBody3D.new()
+	body.position = position
+	body.add_child(_create_collision_shape(shape))
+	add_child(body)
+	return body
+
+func _create_collision_shape(shape: Shape3D) -> CollisionShape3D:
+	var collision_shape := CollisionShape3D.new()
+	collision_shape.shape = shape
+	return collision_shape
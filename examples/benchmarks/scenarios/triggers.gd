@@ -0,0 +1,46 @@
+# Bodies moving through a large number of monitoring areas, which stresses the overlap tracking and
+# reporting of areas.
+
+extends "scenario.gd"
+
+const AREA_COUNT := 1000
+const BODY_COUNT := 2000
+const FIELD_SIZE := 100.0
+
+var _enter_count := 0
+
+func build() -> void:
+	add_ground(FIELD_SIZE * 2)
+
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	var area_shape := BoxShape3D.new()
+	area_shape.size = Vector3(4, 4, 4)
+
+	for i in AREA_COUNT:
+		var area := Area3D.new()
+		area.add_child(_create_collision_shape(area_shape))
+		area.position = Vector3(
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2),
+			2,
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2)
+		)
+
+		area.body_shape_entered.connect(_on_body_shape_entered)
+		add_child(area)
+
+	var body_shape := SphereShape3D.new()
+
+	for i in BODY_COUNT:
+		var position := Vector3(
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2),
+			rng.randf_range(1, 10),
+			rng.randf_range(-FIELD_SIZE / 2, FIELD_SIZE / 2)
+		)
+
+		var body := add_rigid_body(body_shape, position)
+		body.linear_velocity = Vector3(rng.randf_range(-5, 5), 0, rng.randf_range(-5, 5))
+
+func _on_body_shape_entered(_rid: RID, _body: Node3D, _body_shape: int, _area_shape: int) -> void:
+	_enter_count += 1
@@ -0,0 +1,43 @@
+# Bodies dropped onto a large triangle mesh, which stresses the mesh collision paths.
+
+extends "scenario.gd"
+
+const TERRAIN_RESOLUTION := 256
+const TERRAIN_SIZE := 256.0
+const BODY_COUNT := 2000
+
+func build() -> void:
+	var faces := PackedVector3Array()
+	var cell_size := TERRAIN_SIZE / TERRAIN_RESOLUTION
+
+	for z in TERRAIN_RESOLUTION:
+		for x in TERRAIN_RESOLUTION:
+			var v00 := _get_vertex(x, z, cell_size)
+			var v10 := _get_vertex(x + 1, z, cell_size)
+			var v01 := _get_vertex(x, z + 1, cell_size)
+			var v11 := _get_vertex(x + 1, z + 1, cell_size)
+
+			faces.append_array([v00, v10, v11, v00, v11, v01])
+
+	var terrain_shape := ConcavePolygonShape3D.new()
+	terrain_shape.set_faces(faces)
+
+	add_static_body(terrain_shape, Vector3.ZERO)
+
+	var shape := SphereShape3D.new()
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in BODY_COUNT:
+		var position := Vector3(
+			rng.randf_range(-TERRAIN_SIZE / 2, TERRAIN_SIZE / 2),
+			rng.randf_range(5, 20),
+			rng.randf_range(-TERRAIN_SIZE / 2, TERRAIN_SIZE / 2)
+		)
+
+		add_rigid_body(shape, position)
+
+func _get_vertex(x: int, z: int, cell_size: float) -> Vector3:
+	var position := Vector3(x, 0, z) * cell_size - Vector3(TERRAIN_SIZE, 0, TERRAIN_SIZE) / 2
+	position.y = sin(position.x * 0.1) * cos(position.z * 0.1) * 3
+	return position
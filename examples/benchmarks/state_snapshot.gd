@@ -0,0 +1,88 @@
+# Measures how long it takes to save and restore the state of a physics space, both as full states
+# and as states delta-encoded against a previously saved full state, along with their sizes.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/state_snapshot.gd
+
+extends SceneTree
+
+const BODY_COUNTS: Array[int] = [500, 5000]
+const BODY_SPACING := 2.0
+const SETTLE_FRAMES := 10
+const ITERATION_COUNT := 100
+
+func _initialize() -> void:
+	for body_count in BODY_COUNTS:
+		await _run(body_count)
+
+	quit()
+
+func _run(body_count: int) -> void:
+	var level := Node3D.new()
+	var shape := BoxShape3D.new()
+	var grid_size := ceili(sqrt(body_count))
+
+	for i in body_count:
+		var collision_shape := CollisionShape3D.new()
+		collision_shape.shape = shape
+
+		var body := RigidBody3D.new()
+		body.position = Vector3(i % grid_size, 1, i / grid_size) * BODY_SPACING
+		body.add_child(collision_shape)
+
+		level.add_child(body)
+
+	root.add_child(level)
+
+	for i in SETTLE_FRAMES:
+		await physics_frame
+
+	var server := PhysicsServer3D as Object
+	var space := root.get_world_3d().space
+	var no_base := PackedByteArray()
+
+	var keyframe: PackedByteArray = server.call("space_save_state", space, no_base)
+
+	await physics_frame
+
+	var full_state := PackedByteArray()
+	var save_start := Time.get_ticks_usec()
+
+	for i in ITERATION_COUNT:
+		full_state = server.call("space_save_state", space, no_base)
+
+	var save_time := Time.get_ticks_usec() - save_start
+
+	var delta_state := PackedByteArray()
+	var delta_save_start := Time.get_ticks_usec()
+
+	for i in ITERATION_COUNT:
+		delta_state = server.call("space_save_state", space, keyframe)
+
+	var delta_save_time := Time.get_ticks_usec() - delta_save_start
+
+	var restore_start := Time.get_ticks_usec()
+
+	for i in ITERATION_COUNT:
+		server.call("space_restore_state", space, full_state, no_base)
+
+	var restore_time := Time.get_ticks_usec() - restore_start
+
+	var delta_restore_start := Time.get_ticks_usec()
+
+	for i in ITERATION_COUNT:
+		server.call("space_restore_state", space, delta_state, keyframe)
+
+	var delta_restore_time := Time.get_ticks_usec() - delta_restore_start
+
+	print("Bodies: %d" % body_count)
+	print("Full state: %d bytes" % full_state.size())
+	print("Delta state: %d bytes" % delta_state.size())
+	print("Save: %.2f us" % (float(save_time) / ITERATION_COUNT))
+	print("Save (delta): %.2f us" % (float(delta_save_time) / ITERATION_COUNT))
+	print("Restore: %.2f us" % (float(restore_time) / ITERATION_COUNT))
+	print("Restore (delta): %.2f us" % (float(delta_restore_time) / ITERATION_COUNT))
+	print()
+
+	level.free()
+
+	await physics_frame
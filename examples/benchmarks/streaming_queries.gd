@@ -0,0 +1,79 @@
+# Measures the latency of individual ray casts, as well as the time taken by each frame, while
+# static bodies are continuously being streamed into the scene, in order to catch any queries or
+# frames that stall on a broad-phase rebuild.
+#
+# Usage: godot --headless --path examples --script res://benchmarks/streaming_queries.gd
+
+extends SceneTree
+
+const FRAME_COUNT := 300
+const BODIES_PER_FRAME := 200
+const QUERIES_PER_FRAME := 50
+const BODY_SPACING := 2.0
+
+func _initialize() -> void:
+	var level := Node3D.new()
+	root.add_child(level)
+
+	var shape := BoxShape3D.new()
+	var grid_size := ceili(sqrt(FRAME_COUNT * BODIES_PER_FRAME))
+	var extent := grid_size * BODY_SPACING
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	var space_state := root.get_world_3d().direct_space_state
+	var latencies := PackedInt64Array()
+	var frame_times := PackedInt64Array()
+	var body_index := 0
+
+	for frame in FRAME_COUNT:
+		var frame_start := Time.get_ticks_usec()
+
+		for i in BODIES_PER_FRAME:
+			var collision_shape := CollisionShape3D.new()
+			collision_shape.shape = shape
+
+			var column := body_index % grid_size
+			var row := body_index / grid_size
+
+			var body := StaticBody3D.new()
+			body.position = Vector3(column, 0, row) * BODY_SPACING
+			body.add_child(collision_shape)
+
+			level.add_child(body)
+			body_index += 1
+
+		for i in QUERIES_PER_FRAME:
+			var x := rng.randf_range(0, extent)
+			var z := rng.randf_range(0, extent)
+			var query := PhysicsRayQueryParameters3D.create(Vector3(x, 10, z), Vector3(x, -10, z))
+
+			var query_start := Time.get_ticks_usec()
+			space_state.intersect_ray(query)
+			latencies.append(Time.get_ticks_usec() - query_start)
+
+		await physics_frame
+
+		frame_times.append(Time.get_ticks_usec() - frame_start)
+
+	latencies.sort()
+	frame_times.sort()
+
+	print("Bodies: %d" % body_index)
+	print("Queries: %d" % latencies.size())
+	print("Query p50: %d us" % _percentile(latencies, 0.50))
+	print("Query p95: %d us" % _percentile(latencies, 0.95))
+	print("Query p99: %d us" % _percentile(latencies, 0.99))
+	print("Query max: %d us" % latencies[-1])
+	print()
+	print("Frames: %d" % frame_times.size())
+	print("Frame p50: %d us" % _percentile(frame_times, 0.50))
+	print("Frame p95: %d us" % _percentile(frame_times, 0.95))
+	print("Frame p99: %d us" % _percentile(frame_times, 0.99))
+	print("Frame max: %d us" % frame_times[-1])
+
+	quit()
+
+func _percentile(sorted_values: PackedInt64Array, fraction: float) -> int:
+	var index := mini(int(sorted_values.size() * fraction), sorted_values.size() - 1)
+	return sorted_values[index]
@@ -0,0 +1,273 @@
+# Runs a fixed set of scenarios and reports the time spent building and stepping each of them, as
+# well as how much memory they used, as JSON. It also reports the memory used per object for each
+# type of physics object. The report is printed to stdout, or written to the file given by
+# `--output`.
+#
+# Step times are for the whole physics frame, as reported by `Performance.TIME_PHYSICS_PROCESS`,
+# and are not broken down into the individual phases of the step. Memory is reported in two ways:
+# the `static_memory_*` fields come from `OS.get_static_memory_usage`, which only sees Godot's own
+# allocations, while the `jolt_memory_*` fields cover the allocations made by Jolt and are only
+# present when Godot Jolt has been built with `GDJ_TRACK_ALLOCATIONS` enabled.
+#
+# Usage: godot --headless --fixed-fps 60 --path examples --script res://benchmarks/suite.gd
+#        -- [--output=path/to/report.json] [--scenario=name]
+#
+# This can also be run through the `benchmark` target of the CMake project, by configuring it with
+# `-DGDJ_GODOT_EXECUTABLE=path/to/godot`.
+
+extends SceneTree
+
+const Scenario := preload("scenarios/scenario.gd")
+
+const SCENARIOS: Array[Script] = [
+	preload("scenarios/pyramids.gd"),
+	preload("scenarios/debris.gd"),
+	preload("scenarios/ragdolls.gd"),
+	preload("scenarios/trimesh_terrain.gd"),
+	preload("scenarios/height_map_terrain.gd"),
+	preload("scenarios/raycasts.gd"),
+	preload("scenarios/characters.gd"),
+	preload("scenarios/cloth.gd"),
+	preload("scenarios/triggers.gd"),
+]
+
+const OBJECT_MEMORY_COUNT := 10000
+const SOFT_BODY_MEMORY_COUNT := 100
+
+func _initialize() -> void:
+	var args := _parse_args()
+	var results: Array[Dictionary] = []
+
+	for scenario_script in SCENARIOS:
+		var scenario_name := scenario_script.resource_path.get_file().get_basename()
+
+		if args.has("scenario") and args["scenario"] != scenario_name:
+			continue
+
+		var result := await _run(scenario_script)
+		result["name"] = scenario_name
+		results.append(result)
+
+	var object_memory := await _measure_object_memory()
+
+	var report := {
+		"engine_version": Engine.get_version_info()["string"],
+		"physics_engine": ProjectSettings.get_setting("physics/3d/physics_engine"),
+		"physics_ticks_per_second": Engine.physics_ticks_per_second,
+		"processor_name": OS.get_processor_name(),
+		"processor_count": OS.get_processor_count(),
+		"scenarios": results,
+		"object_memory": object_memory,
+	}
+
+	var json := JSON.stringify(report, "\t")
+
+	if args.has("output"):
+		var file := FileAccess.open(args["output"], FileAccess.WRITE)
+
+		if file == null:
+			printerr("Failed to open '%s' for writing." % args["output"])
+			quit(1)
+			return
+
+		file.store_string(json)
+	else:
+		print(json)
+
+	quit()
+
+func _run(scenario_script: Script) -> Dictionary:
+	var memory_start := OS.get_static_memory_usage()
+	var jolt_memory_start := _get_jolt_memory()
+
+	# The peak reported by the engine is for the whole process, so we instead keep track of the
+	# highest usage seen at the end of each frame of this scenario.
+	var memory_peak := memory_start
+	var jolt_memory_peak := jolt_memory_start
+
+	var scenario: Scenario = scenario_script.new()
+
+	var build_start := Time.get_ticks_usec()
+	scenario.build()
+	root.add_child(scenario)
+	var build_time := Time.get_ticks_usec() - build_start
+	memory_peak = maxi(memory_peak, OS.get_static_memory_usage())
+	jolt_memory_peak = maxi(jolt_memory_peak, _get_jolt_memory())
+
+	# The performance monitors are updated at the end of each frame, so we need to wait for the next
+	# physics frame before we can read the time of the one we're interested in.
+	await physics_frame
+	await physics_frame
+
+	var first_step_time := _get_physics_time()
+	var step_times := PackedFloat64Array()
+
+	for i in scenario.step_count:
+		await physics_frame
+		step_times.append(_get_physics_time())
+		memory_peak = maxi(memory_peak, OS.get_static_memory_usage())
+		jolt_memory_peak = maxi(jolt_memory_peak, _get_jolt_memory())
+
+	var memory_end := OS.get_static_memory_usage()
+	var jolt_memory_end := _get_jolt_memory()
+	var active_objects := Performance.get_monitor(Performance.PHYSICS_3D_ACTIVE_OBJECTS)
+
+	scenario.free()
+
+	await physics_frame
+
+	step_times.sort()
+
+	var total_step_time := 0.0
+
+	for step_time in step_times:
+		total_step_time += step_time
+
+	var result := {
+		"build_ms": build_time / 1000.0,
+		"first_step_ms": first_step_time,
+		"step_count": step_times.size(),
+		"step_mean_ms": total_step_time / step_times.size(),
+		"step_p50_ms": _percentile(step_times, 0.50),
+		"step_p95_ms": _percentile(step_times, 0.95),
+		"step_p99_ms": _percentile(step_times, 0.99),
+		"step_max_ms": step_times[-1],
+		"active_objects_at_end": active_objects,
+		"static_memory_bytes": memory_end - memory_start,
+		"static_memory_peak_bytes": memory_peak - memory_start,
+	}
+
+	if jolt_memory_start >= 0:
+		result["jolt_memory_bytes"] = jolt_memory_end - jolt_memory_start
+		result["jolt_memory_peak_bytes"] = jolt_memory_peak - jolt_memory_start
+
+	return result
+
+func _measure_object_memory() -> Dictionary:
+	var space := root.get_world_3d().space
+
+	var shape := PhysicsServer3D.box_shape_create()
+	PhysicsServer3D.shape_set_data(shape, Vector3(0.5, 0.5, 0.5))
+
+	var mesh := PlaneMesh.new()
+	mesh.subdivide_width = 3
+	mesh.subdivide_depth = 3
+
+	var result := {
+		"static_body": await _measure_objects(
+			OBJECT_MEMORY_COUNT,
+			_create_body.bind(PhysicsServer3D.BODY_MODE_STATIC, shape, space)
+		),
+		"rigid_body": await _measure_objects(
+			OBJECT_MEMORY_COUNT,
+			_create_body.bind(PhysicsServer3D.BODY_MODE_RIGID, shape, space)
+		),
+		"area": await _measure_objects(
+			OBJECT_MEMORY_COUNT,
+			_create_area.bind(shape, space)
+		),
+		"soft_body": await _measure_objects(
+			SOFT_BODY_MEMORY_COUNT,
+			_create_soft_body.bind(mesh, space)
+		),
+	}
+
+	PhysicsServer3D.free_rid(shape)
+
+	return result
+
+func _measure_objects(count: int, create_object: Callable) -> Dictionary:
+	await physics_frame
+
+	var memory_start := OS.get_static_memory_usage()
+	var jolt_memory_start := _get_jolt_memory()
+
+	var objects: Array[RID] = []
+
+	for i in count:
+		objects.append(create_object.call(_get_grid_position(i)))
+
+	# Objects are only inserted into the broad-phase as part of the next step, so we wait for that
+	# to happen before we measure anything.
+	await physics_frame
+	await physics_frame
+
+	var memory_end := OS.get_static_memory_usage()
+	var jolt_memory_end := _get_jolt_memory()
+
+	for object in objects:
+		PhysicsServer3D.free_rid(object)
+
+	var result := {
+		"count": count,
+		"static_bytes_per_object": (memory_end - memory_start) / float(count),
+	}
+
+	if jolt_memory_start >= 0 and jolt_memory_end >= 0:
+		result["jolt_bytes_per_object"] = (jolt_memory_end - jolt_memory_start) / float(count)
+
+	return result
+
+func _create_body(position: Vector3, mode: PhysicsServer3D.BodyMode, shape: RID, space: RID) -> RID:
+	var body := PhysicsServer3D.body_create()
+	PhysicsServer3D.body_set_mode(body, mode)
+	PhysicsServer3D.body_add_shape(body, shape)
+	PhysicsServer3D.body_set_state(
+		body,
+		PhysicsServer3D.BODY_STATE_TRANSFORM,
+		Transform3D(Basis(), position)
+	)
+	PhysicsServer3D.body_set_space(body, space)
+	return body
+
+func _create_area(position: Vector3, shape: RID, space: RID) -> RID:
+	var area := PhysicsServer3D.area_create()
+	PhysicsServer3D.area_add_shape(area, shape)
+	PhysicsServer3D.area_set_transform(area, Transform3D(Basis(), position))
+	PhysicsServer3D.area_set_space(area, space)
+	return area
+
+func _create_soft_body(position: Vector3, mesh: Mesh, space: RID) -> RID:
+	var soft_body := PhysicsServer3D.soft_body_create()
+	PhysicsServer3D.soft_body_set_mesh(soft_body, mesh.get_rid())
+	PhysicsServer3D.soft_body_set_transform(soft_body, Transform3D(Basis(), position))
+	PhysicsServer3D.soft_body_set_space(soft_body, space)
+	return soft_body
+
+func _get_grid_position(index: int) -> Vector3:
+	return Vector3(index % 100, 0, index / 100) * 2.0
+
+func _get_jolt_memory() -> int:
+	var server := PhysicsServer3D as Object
+
+	if not server.has_method("get_memory_report"):
+		return -1
+
+	var report: Dictionary = server.call("get_memory_report")
+
+	if report.is_empty():
+		return -1
+
+	var total := 0
+
+	for category: Dictionary in report.values():
+		total += category["live_bytes"]
+
+	return total
+
+func _get_physics_time() -> float:
+	return Performance.get_monitor(Performance.TIME_PHYSICS_PROCESS) * 1000.0
+
+func _percentile(sorted_values: PackedFloat64Array, fraction: float) -> float:
+	var index := mini(int(sorted_values.size() * fraction), sorted_values.size() - 1)
+	return sorted_values[index]
+
+func _parse_args() -> Dictionary:
+	var args := {}
+
+	for arg in OS.get_cmdline_user_args():
+		if arg.begins_with("--") and arg.contains("="):
+			var key_value := arg.trim_prefix("--").split("=", true, 1)
+			args[key_value[0]] = key_value[1]
+
+	return args
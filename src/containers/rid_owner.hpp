@@ -3,12 +3,18 @@
 template<typename TResource>
 // NOLINTNEXTLINE(readability-identifier-naming)
 class RID_PtrOwner {
+	using Mutex = std::shared_mutex;
+
+	using WriteLock = std::unique_lock<Mutex>;
+
 public:
+	using ReadLock = std::shared_lock<Mutex>;
+
 	RID_PtrOwner() = default;
 
-	RID_PtrOwner(const RID_PtrOwner& p_other) = default;
+	RID_PtrOwner(const RID_PtrOwner& p_other) = delete;
 
-	RID_PtrOwner(RID_PtrOwner&& p_other) noexcept = default;
+	RID_PtrOwner(RID_PtrOwner&& p_other) = delete;
 
 	~RID_PtrOwner() {
 		if (ptrs_by_id.size() > 0) {
@@ -23,16 +29,20 @@ public:
 
 	_FORCE_INLINE_ RID make_rid(TResource* p_ptr) {
 		const int64_t id = UtilityFunctions::rid_allocate_id();
+		const WriteLock write_lock(mutex);
 		ptrs_by_id[id] = p_ptr;
 		return UtilityFunctions::rid_from_int64(id);
 	}
 
+	// RIDs are only ever created and freed by the main thread, which means the main thread can look
+	// them up without locking. Any other thread needs to hold the lock from `lock_for_reading`.
 	_FORCE_INLINE_ TResource* get_or_null(const RID& p_rid) const {
 		auto iter = ptrs_by_id.find(p_rid.get_id());
 		return iter != ptrs_by_id.end() ? iter->second : nullptr;
 	}
 
 	_FORCE_INLINE_ void replace(const RID& p_rid, TResource* p_new_ptr) {
+		const WriteLock write_lock(mutex);
 		auto iter = ptrs_by_id.find(p_rid.get_id());
 		ERR_FAIL_COND(iter == ptrs_by_id.end());
 		iter->second = p_new_ptr;
@@ -40,12 +50,19 @@ public:
 
 	_FORCE_INLINE_ bool owns(const RID& p_rid) const { return ptrs_by_id.has(p_rid.get_id()); }
 
-	_FORCE_INLINE_ void free(const RID& p_rid) { ptrs_by_id.erase(p_rid.get_id()); }
+	_FORCE_INLINE_ void free(const RID& p_rid) {
+		const WriteLock write_lock(mutex);
+		ptrs_by_id.erase(p_rid.get_id());
+	}
+
+	_FORCE_INLINE_ ReadLock lock_for_reading() const { return ReadLock(mutex); }
 
-	RID_PtrOwner& operator=(const RID_PtrOwner& p_other) = default;
+	RID_PtrOwner& operator=(const RID_PtrOwner& p_other) = delete;
 
-	RID_PtrOwner& operator=(RID_PtrOwner&& p_other) noexcept = default;
+	RID_PtrOwner& operator=(RID_PtrOwner&& p_other) = delete;
 
 private:
 	HashMap<int64_t, TResource*> ptrs_by_id;
+
+	mutable Mutex mutex;
 };
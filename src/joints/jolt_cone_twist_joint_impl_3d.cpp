@@ -252,14 +252,7 @@ void JoltConeTwistJointImpl3D::rebuild() {
 
 	_shift_reference_frames(Vector3(), Vector3(), shifted_ref_a, shifted_ref_b);
 
-	jolt_ref = _build_swing_twist(
-		jolt_body_a,
-		jolt_body_b,
-		shifted_ref_a,
-		shifted_ref_b,
-		(float)swing_limit_span,
-		(float)twist_limit_span
-	);
+	jolt_ref = _build_swing_twist(jolt_body_a, jolt_body_b, shifted_ref_a, shifted_ref_b);
 
 	space->add_joint(this);
 
@@ -276,38 +269,20 @@ JPH::Constraint* JoltConeTwistJointImpl3D::_build_swing_twist(
 	JPH::Body* p_jolt_body_a,
 	JPH::Body* p_jolt_body_b,
 	const Transform3D& p_shifted_ref_a,
-	const Transform3D& p_shifted_ref_b,
-	float p_swing_limit_span,
-	float p_twist_limit_span
+	const Transform3D& p_shifted_ref_b
 ) const {
 	JPH::SwingTwistConstraintSettings constraint_settings;
 
-	const bool twist_span_valid = p_twist_limit_span >= 0 && p_twist_limit_span <= JPH::JPH_PI;
-	const bool swing_span_valid = p_swing_limit_span >= 0 && p_swing_limit_span <= JPH::JPH_PI;
-
-	if (twist_limit_enabled && twist_span_valid) {
-		constraint_settings.mTwistMinAngle = -p_twist_limit_span;
-		constraint_settings.mTwistMaxAngle = p_twist_limit_span;
-	} else {
-		constraint_settings.mTwistMinAngle = -JPH::JPH_PI;
-		constraint_settings.mTwistMaxAngle = JPH::JPH_PI;
-	}
-
-	if (swing_limit_enabled && swing_span_valid) {
-		constraint_settings.mNormalHalfConeAngle = p_swing_limit_span;
-		constraint_settings.mPlaneHalfConeAngle = p_swing_limit_span;
-	} else {
-		constraint_settings.mNormalHalfConeAngle = JPH::JPH_PI;
-		constraint_settings.mPlaneHalfConeAngle = JPH::JPH_PI;
+	float swing_limit = 0.0f;
 
-		if (!swing_span_valid) {
-			// NOTE(mihe): As far as I can tell this emulates the behavior of Godot Physics, where
-			// the twist span also becomes unbounded if the swing span is a nonsensical value.
-			constraint_settings.mTwistMinAngle = -JPH::JPH_PI;
-			constraint_settings.mTwistMaxAngle = JPH::JPH_PI;
-		}
-	}
+	_calculate_limits(
+		swing_limit,
+		constraint_settings.mTwistMinAngle,
+		constraint_settings.mTwistMaxAngle
+	);
 
+	constraint_settings.mNormalHalfConeAngle = swing_limit;
+	constraint_settings.mPlaneHalfConeAngle = swing_limit;
 	constraint_settings.mSpace = JPH::EConstraintSpace::LocalToBodyCOM;
 	constraint_settings.mPosition1 = to_jolt_r(p_shifted_ref_a.origin);
 	constraint_settings.mTwistAxis1 = to_jolt(p_shifted_ref_a.basis.get_column(Vector3::AXIS_X));
@@ -326,6 +301,55 @@ JPH::Constraint* JoltConeTwistJointImpl3D::_build_swing_twist(
 	}
 }
 
+void JoltConeTwistJointImpl3D::_calculate_limits(
+	float& p_swing_limit,
+	float& p_twist_limit_min,
+	float& p_twist_limit_max
+) const {
+	const auto swing_span = (float)swing_limit_span;
+	const auto twist_span = (float)twist_limit_span;
+
+	const bool twist_span_valid = twist_span >= 0 && twist_span <= JPH::JPH_PI;
+	const bool swing_span_valid = swing_span >= 0 && swing_span <= JPH::JPH_PI;
+
+	if (twist_limit_enabled && twist_span_valid) {
+		p_twist_limit_min = -twist_span;
+		p_twist_limit_max = twist_span;
+	} else {
+		p_twist_limit_min = -JPH::JPH_PI;
+		p_twist_limit_max = JPH::JPH_PI;
+	}
+
+	if (swing_limit_enabled && swing_span_valid) {
+		p_swing_limit = swing_span;
+	} else {
+		p_swing_limit = JPH::JPH_PI;
+
+		if (!swing_span_valid) {
+			// NOTE(mihe): As far as I can tell this emulates the behavior of Godot Physics, where
+			// the twist span also becomes unbounded if the swing span is a nonsensical value.
+			p_twist_limit_min = -JPH::JPH_PI;
+			p_twist_limit_max = JPH::JPH_PI;
+		}
+	}
+}
+
+void JoltConeTwistJointImpl3D::_update_limits() {
+	auto* constraint = static_cast<JPH::SwingTwistConstraint*>(jolt_ref.GetPtr());
+	QUIET_FAIL_NULL(constraint);
+
+	float swing_limit = 0.0f;
+	float twist_limit_min = 0.0f;
+	float twist_limit_max = 0.0f;
+
+	_calculate_limits(swing_limit, twist_limit_min, twist_limit_max);
+
+	constraint->SetNormalHalfConeAngle(swing_limit);
+	constraint->SetPlaneHalfConeAngle(swing_limit);
+	constraint->SetTwistMinAngle(twist_limit_min);
+	constraint->SetTwistMaxAngle(twist_limit_max);
+}
+
 void JoltConeTwistJointImpl3D::_update_swing_motor_state() {
 	if (auto* constraint = static_cast<JPH::SwingTwistConstraint*>(jolt_ref.GetPtr())) {
 		constraint->SetSwingMotorState(
@@ -370,7 +394,7 @@ void JoltConeTwistJointImpl3D::_update_twist_motor_limit() {
 }
 
 void JoltConeTwistJointImpl3D::_limits_changed() {
-	rebuild();
+	_update_limits();
 	_wake_up_bodies();
 }
 
@@ -46,11 +46,17 @@ private:
 		JPH::Body* p_jolt_body_a,
 		JPH::Body* p_jolt_body_b,
 		const Transform3D& p_shifted_ref_a,
-		const Transform3D& p_shifted_ref_b,
-		float p_swing_limit_span,
-		float p_twist_limit_span
+		const Transform3D& p_shifted_ref_b
 	) const;
 
+	void _calculate_limits(
+		float& p_swing_limit,
+		float& p_twist_limit_min,
+		float& p_twist_limit_max
+	) const;
+
+	void _update_limits();
+
 	void _update_swing_motor_state();
 
 	void _update_twist_motor_state();
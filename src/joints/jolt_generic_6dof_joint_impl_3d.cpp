@@ -508,20 +508,12 @@ JPH::Constraint* JoltGeneric6DOFJointImpl3D::_build_6dof(
 	JPH::SixDOFConstraintSettings constraint_settings;
 
 	for (int32_t axis = 0; axis < AXIS_COUNT; ++axis) {
-		double lower = limit_lower[axis];
-		double upper = limit_upper[axis];
+		float lower = 0.0f;
+		float upper = 0.0f;
 
-		if (axis >= AXIS_ANGULAR_X && axis <= AXIS_ANGULAR_Z) {
-			const double temp = lower;
-			lower = -upper;
-			upper = -temp;
-		}
+		_calculate_limits(axis, lower, upper);
 
-		if (!limit_enabled[axis] || lower > upper) {
-			constraint_settings.MakeFreeAxis((JoltAxis)axis);
-		} else {
-			constraint_settings.SetLimitedAxis((JoltAxis)axis, (float)lower, (float)upper);
-		}
+		constraint_settings.SetLimitedAxis((JoltAxis)axis, lower, upper);
 	}
 
 	constraint_settings.mSpace = JPH::EConstraintSpace::LocalToBodyCOM;
@@ -542,6 +534,57 @@ JPH::Constraint* JoltGeneric6DOFJointImpl3D::_build_6dof(
 	}
 }
 
+void JoltGeneric6DOFJointImpl3D::_calculate_limits(
+	int32_t p_axis,
+	float& p_lower,
+	float& p_upper
+) const {
+	double lower = limit_lower[p_axis];
+	double upper = limit_upper[p_axis];
+
+	if (p_axis >= AXIS_ANGULAR_X && p_axis <= AXIS_ANGULAR_Z) {
+		// NOTE(mihe): We flip the direction since Jolt is CCW but Godot is CW.
+		const double temp = lower;
+		lower = -upper;
+		upper = -temp;
+	}
+
+	if (!limit_enabled[p_axis] || lower > upper) {
+		// This is equivalent to `MakeFreeAxis`, which Jolt will detect as such.
+		p_lower = -FLT_MAX;
+		p_upper = FLT_MAX;
+	} else {
+		p_lower = (float)lower;
+		p_upper = (float)upper;
+	}
+}
+
+void JoltGeneric6DOFJointImpl3D::_update_limits() {
+	auto* constraint = static_cast<JPH::SixDOFConstraint*>(jolt_ref.GetPtr());
+	QUIET_FAIL_NULL(constraint);
+
+	JPH::Vec3 lower[2];
+	JPH::Vec3 upper[2];
+
+	for (int32_t axis = 0; axis < AXIS_COUNT; ++axis) {
+		float axis_lower = 0.0f;
+		float axis_upper = 0.0f;
+
+		_calculate_limits(axis, axis_lower, axis_upper);
+
+		if (axis >= AXIS_ANGULAR_X && axis <= AXIS_ANGULAR_Z) {
+			axis_lower = CLAMP(axis_lower, -JPH::JPH_PI, JPH::JPH_PI);
+			axis_upper = CLAMP(axis_upper, -JPH::JPH_PI, JPH::JPH_PI);
+		}
+
+		lower[axis / 3].SetComponent((uint32_t)(axis % 3), axis_lower);
+		upper[axis / 3].SetComponent((uint32_t)(axis % 3), axis_upper);
+	}
+
+	constraint->SetTranslationLimits(lower[0], upper[0]);
+	constraint->SetRotationLimits(lower[1], upper[1]);
+}
+
 void JoltGeneric6DOFJointImpl3D::_update_limit_spring_parameters(int32_t p_axis) {
 	auto* constraint = static_cast<JPH::SixDOFConstraint*>(jolt_ref.GetPtr());
 	QUIET_FAIL_NULL(constraint);
@@ -657,7 +700,7 @@ void JoltGeneric6DOFJointImpl3D::_update_spring_equilibrium(int32_t p_axis) {
 }
 
 void JoltGeneric6DOFJointImpl3D::_limits_changed() {
-	rebuild();
+	_update_limits();
 	_wake_up_bodies();
 }
 
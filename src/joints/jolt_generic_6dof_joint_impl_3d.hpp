@@ -71,6 +71,10 @@ private:
 		const Transform3D& p_shifted_ref_b
 	) const;
 
+	void _calculate_limits(int32_t p_axis, float& p_lower, float& p_upper) const;
+
+	void _update_limits();
+
 	void _update_limit_spring_parameters(int32_t p_axis);
 
 	void _update_motor_state(int32_t p_axis);
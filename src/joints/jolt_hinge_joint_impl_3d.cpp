@@ -281,8 +281,10 @@ void JoltHingeJointImpl3D::rebuild() {
 	float ref_shift = 0.0f;
 	float limit = JPH::JPH_PI;
 
+	limit_midpoint = 0.0;
+
 	if (limits_enabled && limit_lower <= limit_upper) {
-		const double limit_midpoint = (limit_lower + limit_upper) / 2.0f;
+		limit_midpoint = (limit_lower + limit_upper) / 2.0f;
 
 		ref_shift = float(-limit_midpoint);
 		limit = float(limit_upper - limit_midpoint);
@@ -372,6 +374,52 @@ JPH::Constraint* JoltHingeJointImpl3D::_build_fixed(
 	}
 }
 
+bool JoltHingeJointImpl3D::_try_update_limits() {
+	// Jolt requires the limits of a hinge to contain zero, which is why we shift the reference
+	// frames to be centered on the limits when building the constraint. This means we can only
+	// update the limits in-place for as long as they still contain that same midpoint, and the
+	// joint doesn't need to switch to or from being a fixed constraint.
+
+	if (jolt_ref == nullptr || _is_fixed()) {
+		return false;
+	}
+
+	if (jolt_ref->GetSubType() != JPH::EConstraintSubType::Hinge) {
+		return false;
+	}
+
+	auto* constraint = static_cast<JPH::HingeConstraint*>(jolt_ref.GetPtr());
+
+	float limit_min = -JPH::JPH_PI;
+	float limit_max = JPH::JPH_PI;
+
+	if (limits_enabled && limit_lower <= limit_upper) {
+		// NOTE(mihe): We flip the direction since Jolt is CCW but Godot is CW.
+		limit_min = float(limit_midpoint - limit_upper);
+		limit_max = float(limit_midpoint - limit_lower);
+	}
+
+	if (limit_min > 0.0f || limit_min < -JPH::JPH_PI) {
+		return false;
+	}
+
+	if (limit_max < 0.0f || limit_max > JPH::JPH_PI) {
+		return false;
+	}
+
+	JPH::SpringSettings limit_spring_settings;
+
+	if (limit_spring_enabled) {
+		limit_spring_settings.mFrequency = (float)limit_spring_frequency;
+		limit_spring_settings.mDamping = (float)limit_spring_damping;
+	}
+
+	constraint->SetLimits(limit_min, limit_max);
+	constraint->SetLimitsSpringSettings(limit_spring_settings);
+
+	return true;
+}
+
 void JoltHingeJointImpl3D::_update_motor_state() {
 	QUIET_FAIL_COND(_is_fixed());
 
@@ -402,12 +450,18 @@ void JoltHingeJointImpl3D::_update_motor_limit() {
 }
 
 void JoltHingeJointImpl3D::_limits_changed() {
-	rebuild();
+	if (!_try_update_limits()) {
+		rebuild();
+	}
+
 	_wake_up_bodies();
 }
 
 void JoltHingeJointImpl3D::_limit_spring_changed() {
-	rebuild();
+	if (!_try_update_limits()) {
+		rebuild();
+	}
+
 	_wake_up_bodies();
 }
 
@@ -161,6 +161,24 @@ void JoltJointImpl3D::destroy() {
 	jolt_ref = nullptr;
 }
 
+void JoltJointImpl3D::shift_origin(const Vector3& p_offset) {
+	// Only the reference frame of the "world node" is in world space, so joints between two bodies
+	// move along with them without us having to do anything.
+	if (body_a != nullptr && body_b != nullptr) {
+		return;
+	}
+
+	if (body_a == nullptr) {
+		local_ref_a.origin += p_offset;
+	}
+
+	if (body_b == nullptr) {
+		local_ref_b.origin += p_offset;
+	}
+
+	rebuild();
+}
+
 void JoltJointImpl3D::_shift_reference_frames(
 	const Vector3& p_linear_shift,
 	const Vector3& p_angular_shift,
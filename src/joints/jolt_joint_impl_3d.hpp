@@ -51,6 +51,10 @@ public:
 
 	virtual void rebuild() { }
 
+	virtual void body_object_layer_changed() { }
+
+	virtual void shift_origin(const Vector3& p_offset);
+
 protected:
 	void _shift_reference_frames(
 		const Vector3& p_linear_shift,
@@ -483,8 +483,10 @@ void JoltSliderJointImpl3D::rebuild() {
 	float ref_shift = 0.0f;
 	float limit = FLT_MAX;
 
+	limit_midpoint = 0.0;
+
 	if (limits_enabled && limit_lower <= limit_upper) {
-		const double limit_midpoint = (limit_lower + limit_upper) / 2.0f;
+		limit_midpoint = (limit_lower + limit_upper) / 2.0f;
 
 		ref_shift = float(-limit_midpoint);
 		limit = float(limit_upper - limit_midpoint);
@@ -575,6 +577,46 @@ JPH::Constraint* JoltSliderJointImpl3D::_build_fixed(
 	}
 }
 
+bool JoltSliderJointImpl3D::_try_update_limits() {
+	// We shift the reference frames to be centered on the limits when building the constraint,
+	// which means we can only update the limits in-place for as long as they still contain that
+	// same midpoint, and the joint doesn't need to switch to or from being a fixed constraint.
+
+	if (jolt_ref == nullptr || _is_fixed()) {
+		return false;
+	}
+
+	if (jolt_ref->GetSubType() != JPH::EConstraintSubType::Slider) {
+		return false;
+	}
+
+	auto* constraint = static_cast<JPH::SliderConstraint*>(jolt_ref.GetPtr());
+
+	float limit_min = -FLT_MAX;
+	float limit_max = FLT_MAX;
+
+	if (limits_enabled && limit_lower <= limit_upper) {
+		limit_min = float(limit_lower - limit_midpoint);
+		limit_max = float(limit_upper - limit_midpoint);
+	}
+
+	if (limit_min > 0.0f || limit_max < 0.0f) {
+		return false;
+	}
+
+	JPH::SpringSettings limit_spring_settings;
+
+	if (limit_spring_enabled) {
+		limit_spring_settings.mFrequency = (float)limit_spring_frequency;
+		limit_spring_settings.mDamping = (float)limit_spring_damping;
+	}
+
+	constraint->SetLimits(limit_min, limit_max);
+	constraint->SetLimitsSpringSettings(limit_spring_settings);
+
+	return true;
+}
+
 void JoltSliderJointImpl3D::_update_motor_state() {
 	QUIET_FAIL_COND(_is_fixed());
 
@@ -604,12 +646,18 @@ void JoltSliderJointImpl3D::_update_motor_limit() {
 }
 
 void JoltSliderJointImpl3D::_limits_changed() {
-	rebuild();
+	if (!_try_update_limits()) {
+		rebuild();
+	}
+
 	_wake_up_bodies();
 }
 
 void JoltSliderJointImpl3D::_limit_spring_changed() {
-	rebuild();
+	if (!_try_update_limits()) {
+		rebuild();
+	}
+
 	_wake_up_bodies();
 }
 
@@ -61,6 +61,8 @@ private:
 
 	bool _is_fixed() const { return limits_enabled && limit_lower == limit_upper && !_is_sprung(); }
 
+	bool _try_update_limits();
+
 	void _update_motor_state();
 
 	void _update_motor_velocity();
@@ -85,6 +87,8 @@ private:
 
 	double limit_spring_damping = 0.0;
 
+	double limit_midpoint = 0.0;
+
 	double motor_target_speed = 0.0f;
 
 	double motor_max_force = FLT_MAX;
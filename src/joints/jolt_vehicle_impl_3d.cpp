@@ -0,0 +1,383 @@
+#include "jolt_vehicle_impl_3d.hpp"
+
+#include "objects/jolt_body_impl_3d.hpp"
+#include "spaces/jolt_space_3d.hpp"
+
+namespace {
+
+constexpr int32_t TRANSFORM_STRIDE = 12;
+
+float value_or(const PackedFloat32Array& p_array, int32_t p_index, float p_default) {
+	return !p_array.is_empty() ? p_array[p_index] : p_default;
+}
+
+} // namespace
+
+JoltVehicleImpl3D::JoltVehicleImpl3D(JoltBodyImpl3D* p_chassis) {
+	// We can't go through the regular joint constructor here, since it might swap the chassis over
+	// to `body_b` depending on which body the project settings consider to be the "world node".
+
+	body_a = p_chassis;
+	body_a->add_joint(this);
+}
+
+bool JoltVehicleImpl3D::build(const Dictionary& p_settings) {
+	const PackedVector3Array positions = p_settings.get("wheel_positions", PackedVector3Array());
+	const PackedFloat32Array radii = p_settings.get("wheel_radii", PackedFloat32Array());
+	const PackedFloat32Array widths = p_settings.get("wheel_widths", PackedFloat32Array());
+	const PackedFloat32Array min_lengths = p_settings.get(
+		"suspension_min_lengths",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array max_lengths = p_settings.get(
+		"suspension_max_lengths",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array frequencies = p_settings.get(
+		"suspension_frequencies",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array dampings = p_settings.get(
+		"suspension_dampings",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array steer_angles = p_settings.get(
+		"max_steer_angles",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array brake_torques = p_settings.get(
+		"max_brake_torques",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array hand_brake_torques = p_settings.get(
+		"max_hand_brake_torques",
+		PackedFloat32Array()
+	);
+	const PackedInt32Array differentials = p_settings.get("differentials", PackedInt32Array());
+
+	const int32_t wheel_count = positions.size();
+
+	ERR_FAIL_COND_D_MSG(
+		wheel_count == 0,
+		vformat(
+			"Failed to create vehicle for '%s'. The vehicle must have at least one wheel.",
+			body_a->to_string()
+		)
+	);
+
+	const PackedFloat32Array per_wheel_arrays[] = {
+		radii,
+		widths,
+		min_lengths,
+		max_lengths,
+		frequencies,
+		dampings,
+		steer_angles,
+		brake_torques,
+		hand_brake_torques};
+
+	for (const PackedFloat32Array& array : per_wheel_arrays) {
+		ERR_FAIL_COND_D_MSG(
+			!array.is_empty() && array.size() != wheel_count,
+			vformat(
+				"Failed to create vehicle for '%s'. "
+				"Per-wheel arrays must hold %d values for a vehicle with %d wheels.",
+				body_a->to_string(),
+				wheel_count,
+				wheel_count
+			)
+		);
+	}
+
+	ERR_FAIL_COND_D_MSG(
+		differentials.size() % 2 != 0,
+		vformat(
+			"Failed to create vehicle for '%s'. "
+			"Differentials must be given as pairs of left and right wheel indices.",
+			body_a->to_string()
+		)
+	);
+
+	for (int32_t i = 0; i < differentials.size(); ++i) {
+		ERR_FAIL_COND_D_MSG(
+			differentials[i] < -1 || differentials[i] >= wheel_count,
+			vformat(
+				"Failed to create vehicle for '%s'. "
+				"Differential refers to wheel %d, but the vehicle only has %d wheels.",
+				body_a->to_string(),
+				differentials[i],
+				wheel_count
+			)
+		);
+	}
+
+	JPH::Ref<JPH::VehicleConstraintSettings> new_settings = new JPH::VehicleConstraintSettings();
+
+	new_settings->mMaxPitchRollAngle = (float)p_settings.get(
+		"max_pitch_roll_angle",
+		new_settings->mMaxPitchRollAngle
+	);
+
+	wheel_positions.resize(wheel_count);
+
+	for (int32_t i = 0; i < wheel_count; ++i) {
+		wheel_positions[i] = positions[i];
+
+		JPH::Ref<JPH::WheelSettingsWV> wheel = new JPH::WheelSettingsWV();
+
+		wheel->mRadius = value_or(radii, i, wheel->mRadius);
+		wheel->mWidth = value_or(widths, i, wheel->mWidth);
+		wheel->mSuspensionMinLength = value_or(min_lengths, i, wheel->mSuspensionMinLength);
+		wheel->mSuspensionMaxLength = value_or(max_lengths, i, wheel->mSuspensionMaxLength);
+		wheel->mSuspensionSpring.mFrequency = value_or(
+			frequencies,
+			i,
+			wheel->mSuspensionSpring.mFrequency
+		);
+		wheel->mSuspensionSpring.mDamping = value_or(
+			dampings,
+			i,
+			wheel->mSuspensionSpring.mDamping
+		);
+		wheel->mMaxSteerAngle = value_or(steer_angles, i, wheel->mMaxSteerAngle);
+		wheel->mMaxBrakeTorque = value_or(brake_torques, i, wheel->mMaxBrakeTorque);
+		wheel->mMaxHandBrakeTorque = value_or(hand_brake_torques, i, wheel->mMaxHandBrakeTorque);
+
+		ERR_FAIL_COND_D_MSG(
+			wheel->mSuspensionMinLength > wheel->mSuspensionMaxLength,
+			vformat(
+				"Failed to create vehicle for '%s'. "
+				"Wheel %d has a minimum suspension length greater than its maximum.",
+				body_a->to_string(),
+				i
+			)
+		);
+
+		new_settings->mWheels.push_back(wheel);
+	}
+
+	auto* controller = new JPH::WheeledVehicleControllerSettings();
+
+	JPH::VehicleEngineSettings& engine = controller->mEngine;
+	engine.mMaxTorque = (float)p_settings.get("max_engine_torque", engine.mMaxTorque);
+	engine.mMinRPM = (float)p_settings.get("min_rpm", engine.mMinRPM);
+	engine.mMaxRPM = (float)p_settings.get("max_rpm", engine.mMaxRPM);
+
+	const int32_t differential_count = differentials.is_empty()
+		? (wheel_count + 1) / 2
+		: differentials.size() / 2;
+
+	for (int32_t i = 0; i < differential_count; ++i) {
+		JPH::VehicleDifferentialSettings& differential = controller->mDifferentials.emplace_back();
+
+		if (differentials.is_empty()) {
+			// Without any differentials we drive every wheel, treating them as left/right pairs
+			differential.mLeftWheel = i * 2;
+			differential.mRightWheel = i * 2 + 1 < wheel_count ? i * 2 + 1 : -1;
+		} else {
+			differential.mLeftWheel = differentials[i * 2];
+			differential.mRightWheel = differentials[i * 2 + 1];
+		}
+
+		differential.mEngineTorqueRatio = 1.0f / (float)differential_count;
+	}
+
+	new_settings->mController = controller;
+
+	settings = new_settings;
+
+	rebuild();
+
+	return true;
+}
+
+void JoltVehicleImpl3D::set_driver_input(
+	float p_forward,
+	float p_right,
+	float p_brake,
+	float p_hand_brake
+) {
+	forward_input = p_forward;
+	right_input = p_right;
+	brake_input = p_brake;
+	hand_brake_input = p_hand_brake;
+
+	_update_driver_input();
+
+	// Jolt won't wake up the chassis on its own when the input changes
+	if (forward_input != 0.0f || right_input != 0.0f || brake_input != 0.0f ||
+		hand_brake_input != 0.0f)
+	{
+		_wake_up_bodies();
+	}
+}
+
+PackedFloat32Array JoltVehicleImpl3D::get_wheel_states() const {
+	const JPH::VehicleConstraint* vehicle = _get_vehicle();
+
+	if (vehicle == nullptr) {
+		return {};
+	}
+
+	const auto& wheels = vehicle->GetWheels();
+
+	PackedFloat32Array result;
+	result.resize((int64_t)wheels.size() * WHEEL_STATE_STRIDE);
+
+	float* data = result.ptrw();
+
+	for (const JPH::Wheel* wheel : wheels) {
+		const bool has_contact = wheel->HasContact();
+
+		const Vector3 contact_position = has_contact
+			? to_godot(wheel->GetContactPosition())
+			: Vector3();
+
+		const Vector3 contact_normal = has_contact
+			? to_godot(wheel->GetContactNormal())
+			: Vector3();
+
+		*data++ = has_contact ? 1.0f : 0.0f;
+		*data++ = wheel->GetSuspensionLength();
+		*data++ = wheel->GetSteerAngle();
+		*data++ = wheel->GetRotationAngle();
+		*data++ = wheel->GetAngularVelocity();
+		*data++ = (float)contact_position.x;
+		*data++ = (float)contact_position.y;
+		*data++ = (float)contact_position.z;
+		*data++ = (float)contact_normal.x;
+		*data++ = (float)contact_normal.y;
+		*data++ = (float)contact_normal.z;
+	}
+
+	return result;
+}
+
+PackedFloat32Array JoltVehicleImpl3D::get_wheel_transforms() const {
+	const JPH::VehicleConstraint* vehicle = _get_vehicle();
+
+	if (vehicle == nullptr) {
+		return {};
+	}
+
+	const auto wheel_count = (int32_t)vehicle->GetWheels().size();
+
+	PackedFloat32Array result;
+	result.resize((int64_t)wheel_count * TRANSFORM_STRIDE);
+
+	float* data = result.ptrw();
+
+	for (int32_t i = 0; i < wheel_count; ++i) {
+		const JPH::RMat44 jolt_transform = vehicle->GetWheelWorldTransform(
+			(JPH::uint)i,
+			JPH::Vec3::sAxisX(),
+			JPH::Vec3::sAxisY()
+		);
+
+		const Basis basis = to_godot(jolt_transform.GetQuaternion());
+		const Vector3 origin = to_godot(jolt_transform.GetTranslation());
+
+		// Packed the same way as the buffers of `RenderingServer.multimesh_set_buffer`
+		for (int32_t row = 0; row < 3; ++row) {
+			*data++ = (float)basis.rows[row].x;
+			*data++ = (float)basis.rows[row].y;
+			*data++ = (float)basis.rows[row].z;
+			*data++ = (float)origin[row];
+		}
+	}
+
+	return result;
+}
+
+float JoltVehicleImpl3D::get_engine_rpm() const {
+	const JPH::VehicleConstraint* vehicle = _get_vehicle();
+	QUIET_FAIL_NULL_D(vehicle);
+
+	const auto* controller = static_cast<const JPH::WheeledVehicleController*>(
+		vehicle->GetController()
+	);
+
+	return controller->GetEngine().GetCurrentRPM();
+}
+
+int32_t JoltVehicleImpl3D::get_current_gear() const {
+	const JPH::VehicleConstraint* vehicle = _get_vehicle();
+	QUIET_FAIL_NULL_D(vehicle);
+
+	const auto* controller = static_cast<const JPH::WheeledVehicleController*>(
+		vehicle->GetController()
+	);
+
+	return controller->GetTransmission().GetCurrentGear();
+}
+
+void JoltVehicleImpl3D::rebuild() {
+	destroy();
+
+	JoltSpace3D* space = get_space();
+
+	if (space == nullptr || settings == nullptr) {
+		return;
+	}
+
+	// Jolt expects the wheel positions to be relative to the body's origin, which has any scale
+	// baked into its shape rather than its transform.
+	const Vector3 scale = body_a->get_scale();
+
+	for (int32_t i = 0; i < wheel_positions.size(); ++i) {
+		settings->mWheels[(size_t)i]->mPosition = to_jolt(wheel_positions[i] * scale);
+	}
+
+	{
+		const JoltWritableBody3D jolt_body = space->write_body(*body_a);
+		ERR_FAIL_COND(jolt_body.is_invalid());
+
+		jolt_ref = new JPH::VehicleConstraint(*jolt_body, *settings);
+	}
+
+	space->add_joint(this);
+
+	_update_collision_tester();
+	_update_enabled();
+	_update_iterations();
+	_update_driver_input();
+}
+
+void JoltVehicleImpl3D::body_object_layer_changed() {
+	_update_collision_tester();
+}
+
+JPH::VehicleConstraint* JoltVehicleImpl3D::_get_vehicle() const {
+	return static_cast<JPH::VehicleConstraint*>(jolt_ref.GetPtr());
+}
+
+void JoltVehicleImpl3D::_update_driver_input() {
+	JPH::VehicleConstraint* vehicle = _get_vehicle();
+
+	if (vehicle == nullptr) {
+		return;
+	}
+
+	auto* controller = static_cast<JPH::WheeledVehicleController*>(vehicle->GetController());
+
+	controller->SetDriverInput(forward_input, right_input, brake_input, hand_brake_input);
+}
+
+void JoltVehicleImpl3D::_update_collision_tester() {
+	JPH::VehicleConstraint* vehicle = _get_vehicle();
+
+	if (vehicle == nullptr) {
+		return;
+	}
+
+	const JoltReadableBody3D jolt_body = get_space()->read_body(*body_a);
+	ERR_FAIL_COND(jolt_body.is_invalid());
+
+	// Each wheel is tested with a single ray, similar to `VehicleWheel3D`, except that the tests
+	// run inside of the physics step and in parallel with other vehicles. The tester filters on the
+	// chassis' object layer, so it needs to be recreated whenever that layer changes.
+	vehicle->SetVehicleCollisionTester(new JPH::VehicleCollisionTesterRay(
+		jolt_body->GetObjectLayer(),
+		settings->mUp
+	));
+}
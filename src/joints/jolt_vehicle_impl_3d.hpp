@@ -0,0 +1,55 @@
+#pragma once
+
+#include "joints/jolt_joint_impl_3d.hpp"
+
+class JoltVehicleImpl3D final : public JoltJointImpl3D {
+public:
+	// Each wheel state is packed as whether the wheel has contact, its suspension length, steer
+	// angle, rotation angle and angular velocity, followed by its contact position and normal.
+	static constexpr int32_t WHEEL_STATE_STRIDE = 11;
+
+	explicit JoltVehicleImpl3D(JoltBodyImpl3D* p_chassis);
+
+	bool build(const Dictionary& p_settings);
+
+	JoltBodyImpl3D* get_chassis() const { return body_a; }
+
+	int32_t get_wheel_count() const { return wheel_positions.size(); }
+
+	void set_driver_input(float p_forward, float p_right, float p_brake, float p_hand_brake);
+
+	PackedFloat32Array get_wheel_states() const;
+
+	PackedFloat32Array get_wheel_transforms() const;
+
+	float get_engine_rpm() const;
+
+	int32_t get_current_gear() const;
+
+	void rebuild() override;
+
+	void body_object_layer_changed() override;
+
+	// The wheels are positioned relative to the chassis, so there's nothing to shift, and rebuilding
+	// would reset the state of the wheels, engine and transmission.
+	void shift_origin([[maybe_unused]] const Vector3& p_offset) override { }
+
+private:
+	JPH::VehicleConstraint* _get_vehicle() const;
+
+	void _update_driver_input();
+
+	void _update_collision_tester();
+
+	JPH::Ref<JPH::VehicleConstraintSettings> settings;
+
+	LocalVector<Vector3> wheel_positions;
+
+	float forward_input = 0.0f;
+
+	float right_input = 0.0f;
+
+	float brake_input = 0.0f;
+
+	float hand_brake_input = 0.0f;
+};
@@ -49,6 +49,8 @@ void JoltAreaImpl3D::set_transform(const Transform3D& p_transform) {
 			to_jolt(new_transform.basis),
 			JPH::EActivation::DontActivate
 		);
+
+		space->body_teleported(jolt_id);
 	}
 }
 
@@ -185,9 +187,11 @@ void JoltAreaImpl3D::set_body_monitor_callback(const Callable& p_callback) {
 		return;
 	}
 
+	const bool was_monitoring = _is_monitoring_bodies();
+
 	body_monitor_callback = p_callback;
 
-	_body_monitoring_changed();
+	_body_monitoring_changed(was_monitoring, resend_bodies_to_callback);
 }
 
 void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
@@ -195,9 +199,35 @@ void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
 		return;
 	}
 
+	const bool was_monitoring = _is_monitoring_areas();
+
 	area_monitor_callback = p_callback;
 
-	_area_monitoring_changed();
+	_area_monitoring_changed(was_monitoring, resend_areas_to_callback);
+}
+
+void JoltAreaImpl3D::set_batched_body_monitor_callback(const Callable& p_callback) {
+	if (p_callback == batched_body_monitor_callback) {
+		return;
+	}
+
+	const bool was_monitoring = _is_monitoring_bodies();
+
+	batched_body_monitor_callback = p_callback;
+
+	_body_monitoring_changed(was_monitoring, resend_bodies_to_batched_callback);
+}
+
+void JoltAreaImpl3D::set_batched_area_monitor_callback(const Callable& p_callback) {
+	if (p_callback == batched_area_monitor_callback) {
+		return;
+	}
+
+	const bool was_monitoring = _is_monitoring_areas();
+
+	batched_area_monitor_callback = p_callback;
+
+	_area_monitoring_changed(was_monitoring, resend_areas_to_batched_callback);
 }
 
 void JoltAreaImpl3D::set_monitorable(bool p_monitorable) {
@@ -238,6 +268,16 @@ Vector3 JoltAreaImpl3D::get_velocity_at_position([[maybe_unused]] const Vector3&
 	return {0.0f, 0.0f, 0.0f};
 }
 
+void JoltAreaImpl3D::set_priority(float p_priority) {
+	if (priority == p_priority) {
+		return;
+	}
+
+	priority = p_priority;
+
+	_priority_changed();
+}
+
 void JoltAreaImpl3D::set_point_gravity(bool p_enabled) {
 	if (point_gravity == p_enabled) {
 		return;
@@ -268,6 +308,26 @@ void JoltAreaImpl3D::set_point_gravity_distance(float p_distance) {
 	_gravity_changed();
 }
 
+void JoltAreaImpl3D::set_linear_damp(float p_damp) {
+	if (linear_damp == p_damp) {
+		return;
+	}
+
+	linear_damp = p_damp;
+
+	_damp_changed();
+}
+
+void JoltAreaImpl3D::set_angular_damp(float p_damp) {
+	if (angular_damp == p_damp) {
+		return;
+	}
+
+	angular_damp = p_damp;
+
+	_damp_changed();
+}
+
 void JoltAreaImpl3D::set_gravity_mode(OverrideMode p_mode) {
 	if (gravity_mode == p_mode) {
 		return;
@@ -278,6 +338,26 @@ void JoltAreaImpl3D::set_gravity_mode(OverrideMode p_mode) {
 	_gravity_changed();
 }
 
+void JoltAreaImpl3D::set_linear_damp_mode(OverrideMode p_mode) {
+	if (linear_damp_mode == p_mode) {
+		return;
+	}
+
+	linear_damp_mode = p_mode;
+
+	_damp_changed();
+}
+
+void JoltAreaImpl3D::set_angular_damp_mode(OverrideMode p_mode) {
+	if (angular_damp_mode == p_mode) {
+		return;
+	}
+
+	angular_damp_mode = p_mode;
+
+	_damp_changed();
+}
+
 void JoltAreaImpl3D::set_gravity_vector(const Vector3& p_vector) {
 	if (gravity_vector == p_vector) {
 		return;
@@ -405,8 +485,21 @@ void JoltAreaImpl3D::area_exited(const JPH::BodyID& p_body_id) {
 }
 
 void JoltAreaImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
-	_flush_events(bodies_by_id, body_monitor_callback);
-	_flush_events(areas_by_id, area_monitor_callback);
+	_flush_events(
+		bodies_by_id,
+		body_monitor_callback,
+		batched_body_monitor_callback,
+		resend_bodies_to_callback,
+		resend_bodies_to_batched_callback
+	);
+
+	_flush_events(
+		areas_by_id,
+		area_monitor_callback,
+		batched_area_monitor_callback,
+		resend_areas_to_callback,
+		resend_areas_to_batched_callback
+	);
 }
 
 JPH::BroadPhaseLayer JoltAreaImpl3D::_get_broad_phase_layer() const {
@@ -492,11 +585,44 @@ bool JoltAreaImpl3D::_remove_shape_pair(
 	return true;
 }
 
-void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_callback) {
+void JoltAreaImpl3D::_flush_events(
+	OverlapsById& p_objects,
+	const Callable& p_callback,
+	const Callable& p_batched_callback,
+	bool& p_resend_to_callback,
+	bool& p_resend_to_batched_callback
+) {
+	PackedInt32Array statuses;
+	TypedArray<RID> other_rids;
+	PackedInt64Array other_instance_ids;
+	PackedInt32Array other_shape_indices;
+	PackedInt32Array self_shape_indices;
+
+	auto batch_event = [&](PhysicsServer3D::AreaBodyStatus p_status,
+						   const Overlap& p_overlap,
+						   const ShapeIndexPair& p_shape_indices) {
+		statuses.push_back(p_status);
+		other_rids.push_back(p_overlap.rid);
+		other_instance_ids.push_back((int64_t)p_overlap.instance_id);
+		other_shape_indices.push_back(p_shape_indices.other);
+		self_shape_indices.push_back(p_shape_indices.self);
+	};
+
 	p_objects.erase_if([&](auto& p_pair) {
 		auto& [id, overlap] = p_pair;
 
-		if (p_callback.is_valid()) {
+		if (p_callback.is_valid() && p_resend_to_callback) {
+			for (const auto& [id_pair, shape_indices] : overlap.shape_pairs) {
+				_report_event(
+					p_callback,
+					PhysicsServer3D::AREA_BODY_ADDED,
+					overlap.rid,
+					overlap.instance_id,
+					shape_indices.other,
+					shape_indices.self
+				);
+			}
+		} else if (p_callback.is_valid()) {
 			for (auto& shape_indices : overlap.pending_removed) {
 				_report_event(
 					p_callback,
@@ -520,11 +646,39 @@ void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_ca
 			}
 		}
 
+		if (p_batched_callback.is_valid() && p_resend_to_batched_callback) {
+			for (const auto& [id_pair, shape_indices] : overlap.shape_pairs) {
+				batch_event(PhysicsServer3D::AREA_BODY_ADDED, overlap, shape_indices);
+			}
+		} else if (p_batched_callback.is_valid()) {
+			for (auto& shape_indices : overlap.pending_removed) {
+				batch_event(PhysicsServer3D::AREA_BODY_REMOVED, overlap, shape_indices);
+			}
+
+			for (auto& shape_indices : overlap.pending_added) {
+				batch_event(PhysicsServer3D::AREA_BODY_ADDED, overlap, shape_indices);
+			}
+		}
+
 		overlap.pending_removed.clear();
 		overlap.pending_added.clear();
 
 		return overlap.shape_pairs.is_empty();
 	});
+
+	p_resend_to_callback = false;
+	p_resend_to_batched_callback = false;
+
+	if (!statuses.is_empty()) {
+		_report_events(
+			p_batched_callback,
+			statuses,
+			other_rids,
+			other_instance_ids,
+			other_shape_indices,
+			self_shape_indices
+		);
+	}
 }
 
 void JoltAreaImpl3D::_report_event(
@@ -552,6 +706,31 @@ void JoltAreaImpl3D::_report_event(
 	p_callback.callv(arguments);
 }
 
+void JoltAreaImpl3D::_report_events(
+	const Callable& p_callback,
+	const PackedInt32Array& p_statuses,
+	const TypedArray<RID>& p_other_rids,
+	const PackedInt64Array& p_other_instance_ids,
+	const PackedInt32Array& p_other_shape_indices,
+	const PackedInt32Array& p_self_shape_indices
+) const {
+	ERR_FAIL_COND(!p_callback.is_valid());
+
+	static thread_local Array arguments = []() {
+		Array array;
+		array.resize(5);
+		return array;
+	}();
+
+	arguments[0] = p_statuses;
+	arguments[1] = p_other_rids;
+	arguments[2] = p_other_instance_ids;
+	arguments[3] = p_other_shape_indices;
+	arguments[4] = p_self_shape_indices;
+
+	p_callback.callv(arguments);
+}
+
 void JoltAreaImpl3D::_notify_body_entered(const JPH::BodyID& p_body_id) {
 	const JoltReadableBody3D jolt_body = space->read_body(p_body_id);
 
@@ -652,19 +831,31 @@ void JoltAreaImpl3D::_space_changed() {
 	_update_default_gravity();
 }
 
-void JoltAreaImpl3D::_body_monitoring_changed() {
-	if (has_body_monitor_callback()) {
+void JoltAreaImpl3D::_body_monitoring_changed(bool p_was_monitoring, bool& p_resend) {
+	const bool is_monitoring = _is_monitoring_bodies();
+
+	if (is_monitoring && !p_was_monitoring) {
 		_force_bodies_entered();
-	} else {
+	} else if (!is_monitoring && p_was_monitoring) {
 		_force_bodies_exited(false);
+	} else if (is_monitoring) {
+		// The other callback is already being sent events for the current overlaps, so rather than
+		// forcing them to be entered again we only send them to the callback that was just set.
+		p_resend = true;
 	}
 }
 
-void JoltAreaImpl3D::_area_monitoring_changed() {
-	if (has_area_monitor_callback()) {
+void JoltAreaImpl3D::_area_monitoring_changed(bool p_was_monitoring, bool& p_resend) {
+	const bool is_monitoring = _is_monitoring_areas();
+
+	if (is_monitoring && !p_was_monitoring) {
 		_force_areas_entered();
-	} else {
+	} else if (!is_monitoring && p_was_monitoring) {
 		_force_areas_exited(false);
+	} else if (is_monitoring) {
+		// The other callback is already being sent events for the current overlaps, so rather than
+		// forcing them to be entered again we only send them to the callback that was just set.
+		p_resend = true;
 	}
 }
 
@@ -672,6 +863,21 @@ void JoltAreaImpl3D::_monitorable_changed() {
 	_update_object_layer();
 }
 
+void JoltAreaImpl3D::_priority_changed() {
+	_overrides_changed();
+}
+
 void JoltAreaImpl3D::_gravity_changed() {
 	_update_default_gravity();
+	_overrides_changed();
+}
+
+void JoltAreaImpl3D::_damp_changed() {
+	_overrides_changed();
+}
+
+void JoltAreaImpl3D::_overrides_changed() {
+	if (space != nullptr) {
+		space->area_overrides_changed();
+	}
 }
@@ -85,6 +85,18 @@ public:
 
 	void set_area_monitor_callback(const Callable& p_callback);
 
+	bool has_batched_body_monitor_callback() const {
+		return batched_body_monitor_callback.is_valid();
+	}
+
+	void set_batched_body_monitor_callback(const Callable& p_callback);
+
+	bool has_batched_area_monitor_callback() const {
+		return batched_area_monitor_callback.is_valid();
+	}
+
+	void set_batched_area_monitor_callback(const Callable& p_callback);
+
 	bool is_monitorable() const { return monitorable; }
 
 	void set_monitorable(bool p_monitorable);
@@ -111,7 +123,7 @@ public:
 
 	float get_priority() const { return priority; }
 
-	void set_priority(float p_priority) { priority = p_priority; }
+	void set_priority(float p_priority);
 
 	float get_gravity() const { return gravity; }
 
@@ -123,11 +135,11 @@ public:
 
 	float get_linear_damp() const { return linear_damp; }
 
-	void set_linear_damp(float p_damp) { linear_damp = p_damp; }
+	void set_linear_damp(float p_damp);
 
 	float get_angular_damp() const { return angular_damp; }
 
-	void set_angular_damp(float p_damp) { angular_damp = p_damp; }
+	void set_angular_damp(float p_damp);
 
 	OverrideMode get_gravity_mode() const { return gravity_mode; }
 
@@ -135,11 +147,11 @@ public:
 
 	OverrideMode get_linear_damp_mode() const { return linear_damp_mode; }
 
-	void set_linear_damp_mode(OverrideMode p_mode) { linear_damp_mode = p_mode; }
+	void set_linear_damp_mode(OverrideMode p_mode);
 
 	OverrideMode get_angular_damp_mode() const { return angular_damp_mode; }
 
-	void set_angular_damp_mode(OverrideMode p_mode) { angular_damp_mode = p_mode; }
+	void set_angular_damp_mode(OverrideMode p_mode);
 
 	Vector3 get_gravity_vector() const { return gravity_vector; }
 
@@ -209,7 +221,13 @@ private:
 		const JPH::SubShapeID& p_self_shape_id
 	);
 
-	void _flush_events(OverlapsById& p_objects, const Callable& p_callback);
+	void _flush_events(
+		OverlapsById& p_objects,
+		const Callable& p_callback,
+		const Callable& p_batched_callback,
+		bool& p_resend_to_callback,
+		bool& p_resend_to_batched_callback
+	);
 
 	void _report_event(
 		const Callable& p_callback,
@@ -220,6 +238,15 @@ private:
 		int32_t p_self_shape_index
 	) const;
 
+	void _report_events(
+		const Callable& p_callback,
+		const PackedInt32Array& p_statuses,
+		const TypedArray<RID>& p_other_rids,
+		const PackedInt64Array& p_other_instance_ids,
+		const PackedInt32Array& p_other_shape_indices,
+		const PackedInt32Array& p_self_shape_indices
+	) const;
+
 	void _notify_body_entered(const JPH::BodyID& p_body_id);
 
 	void _notify_body_exited(const JPH::BodyID& p_body_id);
@@ -240,14 +267,28 @@ private:
 
 	void _space_changed() override;
 
-	void _body_monitoring_changed();
+	bool _is_monitoring_bodies() const {
+		return has_body_monitor_callback() || has_batched_body_monitor_callback();
+	}
+
+	bool _is_monitoring_areas() const {
+		return has_area_monitor_callback() || has_batched_area_monitor_callback();
+	}
 
-	void _area_monitoring_changed();
+	void _body_monitoring_changed(bool p_was_monitoring, bool& p_resend);
+
+	void _area_monitoring_changed(bool p_was_monitoring, bool& p_resend);
 
 	void _monitorable_changed();
 
+	void _priority_changed();
+
 	void _gravity_changed();
 
+	void _damp_changed();
+
+	void _overrides_changed();
+
 	OverlapsById bodies_by_id;
 
 	OverlapsById areas_by_id;
@@ -258,6 +299,10 @@ private:
 
 	Callable area_monitor_callback;
 
+	Callable batched_body_monitor_callback;
+
+	Callable batched_area_monitor_callback;
+
 	float priority = 0.0f;
 
 	float gravity = 9.8f;
@@ -277,4 +322,12 @@ private:
 	bool monitorable = false;
 
 	bool point_gravity = false;
+
+	bool resend_bodies_to_callback = false;
+
+	bool resend_bodies_to_batched_callback = false;
+
+	bool resend_areas_to_callback = false;
+
+	bool resend_areas_to_batched_callback = false;
 };
@@ -4,6 +4,7 @@
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_group_filter.hpp"
 #include "objects/jolt_physics_direct_body_state_3d.hpp"
+#include "objects/jolt_ragdoll_impl_3d.hpp"
 #include "objects/jolt_soft_body_impl_3d.hpp"
 #include "servers/jolt_project_settings.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
@@ -66,15 +67,24 @@ void JoltBodyImpl3D::set_transform(Transform3D p_transform) {
 	if (!in_space()) {
 		jolt_settings->mPosition = to_jolt_r(p_transform.origin);
 		jolt_settings->mRotation = to_jolt(p_transform.basis);
+
+		_reset_interpolation(jolt_settings->mPosition, jolt_settings->mRotation);
 	} else if (is_kinematic()) {
 		kinematic_transform = p_transform;
 	} else {
+		const JPH::RVec3 new_position = to_jolt_r(p_transform.origin);
+		const JPH::Quat new_rotation = to_jolt(p_transform.basis);
+
 		space->get_body_iface().SetPositionAndRotation(
 			jolt_id,
-			to_jolt_r(p_transform.origin),
-			to_jolt(p_transform.basis),
+			new_position,
+			new_rotation,
 			JPH::EActivation::DontActivate
 		);
+
+		space->body_teleported(jolt_id);
+
+		_reset_interpolation(new_position, new_rotation);
 	}
 
 	_transform_changed();
@@ -247,6 +257,16 @@ void JoltBodyImpl3D::set_is_sleeping(bool p_enabled) {
 
 	JPH::BodyInterface& body_iface = space->get_body_iface();
 
+	if (!body_iface.IsAdded(jolt_id)) {
+		// Bodies that are still waiting to be added to the space will be activated once added, so
+		// there's nothing to wake up, but in order to put one to sleep we need to add it first.
+		if (!p_enabled) {
+			return;
+		}
+
+		space->add_pending_bodies();
+	}
+
 	if (p_enabled) {
 		body_iface.DeactivateBody(jolt_id);
 	} else {
@@ -742,7 +762,7 @@ void JoltBodyImpl3D::set_constant_torque(const Vector3& p_torque) {
 }
 
 void JoltBodyImpl3D::add_collision_exception(const RID& p_excepted_body) {
-	exceptions.push_back(p_excepted_body);
+	exceptions.ordered_insert(p_excepted_body);
 
 	_exceptions_changed();
 }
@@ -754,7 +774,7 @@ void JoltBodyImpl3D::remove_collision_exception(const RID& p_excepted_body) {
 }
 
 bool JoltBodyImpl3D::has_collision_exception(const RID& p_excepted_body) const {
-	return exceptions.find(p_excepted_body) >= 0;
+	return std::binary_search(exceptions.begin(), exceptions.end(), p_excepted_body);
 }
 
 TypedArray<RID> JoltBodyImpl3D::get_collision_exceptions() const {
@@ -794,6 +814,13 @@ void JoltBodyImpl3D::remove_joint(JoltJointImpl3D* p_joint) {
 	_joints_changed();
 }
 
+void JoltBodyImpl3D::set_ragdoll(JoltRagdollImpl3D* p_ragdoll, int32_t p_bone) {
+	ragdoll = p_ragdoll;
+	ragdoll_bone = p_bone;
+
+	_update_group_filter();
+}
+
 void JoltBodyImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
 	if (!sync_state) {
 		return;
@@ -858,6 +885,52 @@ void JoltBodyImpl3D::pre_step(float p_step, JPH::Body& p_jolt_body) {
 	contact_count = 0;
 }
 
+void JoltBodyImpl3D::post_step(float p_step, JPH::Body& p_jolt_body) {
+	JoltShapedObjectImpl3D::post_step(p_step, p_jolt_body);
+
+	previous_position = current_position;
+	previous_rotation = current_rotation;
+
+	current_position = p_jolt_body.GetPosition();
+	current_rotation = p_jolt_body.GetRotation();
+}
+
+void JoltBodyImpl3D::state_restored(const JPH::Body& p_jolt_body) {
+	sync_state = true;
+
+	// Interpolating between the states from before and after the rollback would only ever show
+	// motion that never actually happened.
+	_reset_interpolation(p_jolt_body.GetPosition(), p_jolt_body.GetRotation());
+}
+
+void JoltBodyImpl3D::shift_origin(const Vector3& p_offset) {
+	// This gets called for many bodies at once from multiple threads, so it must only ever touch
+	// the state of this particular body.
+
+	const JPH::RVec3 offset = to_jolt_r(p_offset);
+
+	previous_position += offset;
+	current_position += offset;
+
+	kinematic_transform.origin += p_offset;
+
+	for (Contact& contact : contacts) {
+		contact.position += p_offset;
+		contact.collider_position += p_offset;
+	}
+
+	sync_state = true;
+}
+
+Transform3D JoltBodyImpl3D::get_interpolated_transform(float p_fraction) const {
+	const JPH::RVec3 position = previous_position +
+		(current_position - previous_position) * p_fraction;
+
+	const JPH::Quat rotation = previous_rotation.SLERP(current_rotation, p_fraction);
+
+	return Transform3D(to_godot(rotation), to_godot(position)).scaled_local(scale);
+}
+
 JoltPhysicsDirectBodyState3DExtension* JoltBodyImpl3D::get_direct_state() {
 	if (direct_state == nullptr) {
 		direct_state = memnew(JoltPhysicsDirectBodyState3DExtension(this));
@@ -1048,7 +1121,55 @@ void JoltBodyImpl3D::set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool p_enab
 	}
 }
 
+void JoltBodyImpl3D::set_solver_velocity_iterations(int32_t p_iterations) {
+	ERR_FAIL_COND_MSG(
+		p_iterations < 0 || p_iterations > UINT8_MAX,
+		vformat(
+			"Invalid solver velocity iterations for '%s'. "
+			"Iterations must be between 0 and %d, but %d was provided.",
+			to_string(),
+			UINT8_MAX,
+			p_iterations
+		)
+	);
+
+	if (velocity_iterations == p_iterations) {
+		return;
+	}
+
+	velocity_iterations = p_iterations;
+
+	_iterations_changed();
+}
+
+void JoltBodyImpl3D::set_solver_position_iterations(int32_t p_iterations) {
+	ERR_FAIL_COND_MSG(
+		p_iterations < 0 || p_iterations > UINT8_MAX,
+		vformat(
+			"Invalid solver position iterations for '%s'. "
+			"Iterations must be between 0 and %d, but %d was provided.",
+			to_string(),
+			UINT8_MAX,
+			p_iterations
+		)
+	);
+
+	if (position_iterations == p_iterations) {
+		return;
+	}
+
+	position_iterations = p_iterations;
+
+	_iterations_changed();
+}
+
 bool JoltBodyImpl3D::can_interact_with(const JoltBodyImpl3D& p_other) const {
+	if (ragdoll != nullptr && ragdoll == p_other.ragdoll &&
+		!ragdoll->can_bones_collide(ragdoll_bone, p_other.ragdoll_bone))
+	{
+		return false;
+	}
+
 	return (can_collide_with(p_other) || p_other.can_collide_with(*this)) &&
 		!has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
 }
@@ -1126,6 +1247,8 @@ void JoltBodyImpl3D::_add_to_space() {
 	jolt_settings->mAngularDamping = 0.0f;
 	jolt_settings->mMaxLinearVelocity = JoltProjectSettings::get_max_linear_velocity();
 	jolt_settings->mMaxAngularVelocity = JoltProjectSettings::get_max_angular_velocity();
+	jolt_settings->mNumVelocityStepsOverride = (JPH::uint)velocity_iterations;
+	jolt_settings->mNumPositionStepsOverride = (JPH::uint)position_iterations;
 
 	if (JoltProjectSettings::use_edge_removal_for_bodies()) {
 		jolt_settings->mEnhancedInternalEdgeRemoval = true;
@@ -1147,8 +1270,7 @@ void JoltBodyImpl3D::_integrate_forces(float p_step, JPH::Body& p_jolt_body) {
 		return;
 	}
 
-	_update_gravity(p_jolt_body);
-	_update_damp();
+	_update_area_overrides(p_jolt_body);
 
 	if (!custom_integrator) {
 		JPH::MotionProperties& motion_properties = *p_jolt_body.GetMotionPropertiesUnchecked();
@@ -1208,8 +1330,7 @@ void JoltBodyImpl3D::_pre_step_rigid(float p_step, JPH::Body& p_jolt_body) {
 }
 
 void JoltBodyImpl3D::_pre_step_kinematic(float p_step, JPH::Body& p_jolt_body) {
-	_update_gravity(p_jolt_body);
-	_update_damp();
+	_update_area_overrides(p_jolt_body);
 
 	_move_kinematic(p_step, p_jolt_body);
 
@@ -1328,65 +1449,95 @@ void JoltBodyImpl3D::_update_mass_properties() {
 	);
 }
 
-void JoltBodyImpl3D::_update_gravity(JPH::Body& p_jolt_body) {
-	gravity = Vector3();
+void JoltBodyImpl3D::_update_area_overrides(JPH::Body& p_jolt_body) {
+	const uint64_t space_version = space->get_area_overrides_version();
+
+	// The contributions from our areas only change if the set of areas changes, or any of their
+	// properties change, so we can skip walking the areas entirely when neither of those happened,
+	// with the exception of point gravity, which depends on our position.
+	const bool cached = !area_overrides_dirty && area_overrides_version == space_version;
+
+	_update_gravity(p_jolt_body, cached && area_gravity_uniform);
+	_update_damp(cached);
+
+	area_overrides_version = space_version;
+	area_overrides_dirty = false;
+}
 
-	const Vector3 position = to_godot(p_jolt_body.GetPosition());
+void JoltBodyImpl3D::_update_gravity(JPH::Body& p_jolt_body, bool p_cached) {
+	if (!p_cached) {
+		area_gravity = Vector3();
+		area_gravity_uniform = true;
 
-	bool gravity_done = false;
+		const Vector3 position = to_godot(p_jolt_body.GetPosition());
 
-	for (const JoltAreaImpl3D* area : areas) {
-		gravity_done = integrate(gravity, area->get_gravity_mode(), [&]() {
-			return area->compute_gravity(position);
-		});
+		bool gravity_done = false;
 
-		if (gravity_done) {
-			break;
+		for (const JoltAreaImpl3D* area : areas) {
+			gravity_done = integrate(area_gravity, area->get_gravity_mode(), [&]() {
+				area_gravity_uniform &= !area->is_point_gravity();
+				return area->compute_gravity(position);
+			});
+
+			if (gravity_done) {
+				break;
+			}
 		}
-	}
 
-	if (!gravity_done) {
-		gravity += space->get_default_area()->compute_gravity(position);
+		if (!gravity_done) {
+			const JoltAreaImpl3D* default_area = space->get_default_area();
+			area_gravity_uniform &= !default_area->is_point_gravity();
+			area_gravity += default_area->compute_gravity(position);
+		}
 	}
 
-	gravity *= gravity_scale;
+	gravity = area_gravity * gravity_scale;
 }
 
-void JoltBodyImpl3D::_update_damp() {
-	total_linear_damp = 0.0;
-	total_angular_damp = 0.0;
+void JoltBodyImpl3D::_update_damp(bool p_cached) {
+	if (!p_cached) {
+		area_linear_damp = 0.0f;
+		area_angular_damp = 0.0f;
 
-	bool linear_damp_done = linear_damp_mode == PhysicsServer3D::BODY_DAMP_MODE_REPLACE;
-	bool angular_damp_done = angular_damp_mode == PhysicsServer3D::BODY_DAMP_MODE_REPLACE;
+		bool linear_damp_done = false;
+		bool angular_damp_done = false;
 
-	for (const JoltAreaImpl3D* area : areas) {
-		if (!linear_damp_done) {
-			linear_damp_done = integrate(total_linear_damp, area->get_linear_damp_mode(), [&]() {
-				return area->get_linear_damp();
-			});
-		}
+		for (const JoltAreaImpl3D* area : areas) {
+			if (!linear_damp_done) {
+				linear_damp_done = integrate(
+					area_linear_damp,
+					area->get_linear_damp_mode(),
+					[&]() { return area->get_linear_damp(); }
+				);
+			}
 
-		if (!angular_damp_done) {
-			angular_damp_done = integrate(total_angular_damp, area->get_angular_damp_mode(), [&]() {
-				return area->get_angular_damp();
-			});
-		}
+			if (!angular_damp_done) {
+				angular_damp_done = integrate(
+					area_angular_damp,
+					area->get_angular_damp_mode(),
+					[&]() { return area->get_angular_damp(); }
+				);
+			}
 
-		if (linear_damp_done && angular_damp_done) {
-			break;
+			if (linear_damp_done && angular_damp_done) {
+				break;
+			}
 		}
-	}
 
-	const JoltAreaImpl3D* default_area = space->get_default_area();
+		const JoltAreaImpl3D* default_area = space->get_default_area();
 
-	if (!linear_damp_done) {
-		total_linear_damp += default_area->get_linear_damp();
-	}
+		if (!linear_damp_done) {
+			area_linear_damp += default_area->get_linear_damp();
+		}
 
-	if (!angular_damp_done) {
-		total_angular_damp += default_area->get_angular_damp();
+		if (!angular_damp_done) {
+			area_angular_damp += default_area->get_angular_damp();
+		}
 	}
 
+	total_linear_damp = area_linear_damp;
+	total_angular_damp = area_angular_damp;
+
 	switch (linear_damp_mode) {
 		case PhysicsServer3D::BODY_DAMP_MODE_COMBINE: {
 			total_linear_damp += linear_damp;
@@ -1412,10 +1563,26 @@ void JoltBodyImpl3D::_update_kinematic_transform() {
 	}
 }
 
+void JoltBodyImpl3D::_reset_interpolation(
+	const JPH::RVec3& p_position,
+	const JPH::Quat& p_rotation
+) {
+	// Since this is meant to be a teleport, we don't want to interpolate from where we were before
+	previous_position = p_position;
+	previous_rotation = p_rotation;
+
+	current_position = p_position;
+	current_rotation = p_rotation;
+}
+
 void JoltBodyImpl3D::_update_joint_constraints() {
 	for (JoltJointImpl3D* joint : joints) {
 		joint->rebuild();
 	}
+
+	if (ragdoll != nullptr) {
+		ragdoll->rebuild_bone_constraints(ragdoll_bone);
+	}
 }
 
 void JoltBodyImpl3D::_update_possible_kinematic_contacts() {
@@ -1431,10 +1598,29 @@ void JoltBodyImpl3D::_update_possible_kinematic_contacts() {
 	}
 }
 
+void JoltBodyImpl3D::_update_iterations() {
+	if (!in_space()) {
+		jolt_settings->mNumVelocityStepsOverride = (JPH::uint)velocity_iterations;
+		jolt_settings->mNumPositionStepsOverride = (JPH::uint)position_iterations;
+		return;
+	}
+
+	const JoltWritableBody3D body = space->write_body(jolt_id);
+	ERR_FAIL_COND(body.is_invalid());
+
+	JPH::MotionProperties& motion_properties = *body->GetMotionPropertiesUnchecked();
+	motion_properties.SetNumVelocityStepsOverride((JPH::uint)velocity_iterations);
+	motion_properties.SetNumPositionStepsOverride((JPH::uint)position_iterations);
+}
+
 void JoltBodyImpl3D::_destroy_joint_constraints() {
 	for (JoltJointImpl3D* joint : joints) {
 		joint->destroy();
 	}
+
+	if (ragdoll != nullptr) {
+		ragdoll->destroy_bone_constraints(ragdoll_bone);
+	}
 }
 
 void JoltBodyImpl3D::_exit_all_areas() {
@@ -1446,7 +1632,11 @@ void JoltBodyImpl3D::_exit_all_areas() {
 }
 
 void JoltBodyImpl3D::_update_group_filter() {
-	JPH::GroupFilter* group_filter = !exceptions.is_empty() ? JoltGroupFilter::instance : nullptr;
+	// Bones rely on `can_interact_with` to filter out collisions with the rest of their ragdoll,
+	// which mirrors the group filter table that Jolt's own ragdolls would use.
+	JPH::GroupFilter* group_filter = !exceptions.is_empty() || ragdoll != nullptr
+		? JoltGroupFilter::instance
+		: nullptr;
 
 	if (!in_space()) {
 		jolt_settings->mCollisionGroup.SetGroupFilter(group_filter);
@@ -1493,6 +1683,7 @@ void JoltBodyImpl3D::_space_changed() {
 }
 
 void JoltBodyImpl3D::_areas_changed() {
+	area_overrides_dirty = true;
 	wake_up();
 }
 
@@ -1500,6 +1691,12 @@ void JoltBodyImpl3D::_joints_changed() {
 	wake_up();
 }
 
+void JoltBodyImpl3D::_object_layer_changed() {
+	for (JoltJointImpl3D* joint : joints) {
+		joint->body_object_layer_changed();
+	}
+}
+
 void JoltBodyImpl3D::_transform_changed() {
 	wake_up();
 }
@@ -1521,3 +1718,8 @@ void JoltBodyImpl3D::_contact_reporting_changed() {
 	_update_possible_kinematic_contacts();
 	wake_up();
 }
+
+void JoltBodyImpl3D::_iterations_changed() {
+	_update_iterations();
+	wake_up();
+}
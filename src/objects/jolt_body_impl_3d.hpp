@@ -5,6 +5,7 @@
 
 class JoltAreaImpl3D;
 class JoltJointImpl3D;
+class JoltRagdollImpl3D;
 class JoltSoftBodyImpl3D;
 
 class JoltBodyImpl3D final : public JoltShapedObjectImpl3D {
@@ -108,6 +109,10 @@ public:
 
 	bool reports_all_kinematic_contacts() const;
 
+	bool estimates_contact_impulses() const { return contact_impulse_estimation; }
+
+	void set_contact_impulse_estimation(bool p_enabled) { contact_impulse_estimation = p_enabled; }
+
 	void add_contact(
 		const JoltBodyImpl3D* p_collider,
 		float p_depth,
@@ -169,10 +174,30 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint);
 
+	const LocalVector<JoltJointImpl3D*>& get_joints() const { return joints; }
+
+	JoltRagdollImpl3D* get_ragdoll() const { return ragdoll; }
+
+	int32_t get_ragdoll_bone() const { return ragdoll_bone; }
+
+	void set_ragdoll(JoltRagdollImpl3D* p_ragdoll, int32_t p_bone);
+
 	void call_queries(JPH::Body& p_jolt_body);
 
+	void state_restored(const JPH::Body& p_jolt_body);
+
+	void physics_system_changing() { _destroy_joint_constraints(); }
+
+	void physics_system_changed() { _update_joint_constraints(); }
+
+	void shift_origin(const Vector3& p_offset);
+
 	void pre_step(float p_step, JPH::Body& p_jolt_body) override;
 
+	void post_step(float p_step, JPH::Body& p_jolt_body) override;
+
+	Transform3D get_interpolated_transform(float p_fraction) const;
+
 	JoltPhysicsDirectBodyState3DExtension* get_direct_state();
 
 	PhysicsServer3D::BodyMode get_mode() const { return mode; }
@@ -245,6 +270,14 @@ public:
 
 	bool are_axes_locked() const { return locked_axes != 0; }
 
+	int32_t get_solver_velocity_iterations() const { return velocity_iterations; }
+
+	void set_solver_velocity_iterations(int32_t p_iterations);
+
+	int32_t get_solver_position_iterations() const { return position_iterations; }
+
+	void set_solver_position_iterations(int32_t p_iterations);
+
 	bool can_interact_with(const JoltBodyImpl3D& p_other) const override;
 
 	bool can_interact_with(const JoltSoftBodyImpl3D& p_other) const override;
@@ -278,18 +311,24 @@ private:
 
 	void _update_mass_properties();
 
-	void _update_gravity(JPH::Body& p_jolt_body);
+	void _update_area_overrides(JPH::Body& p_jolt_body);
 
-	void _update_damp();
+	void _update_gravity(JPH::Body& p_jolt_body, bool p_cached);
+
+	void _update_damp(bool p_cached);
 
 	void _update_kinematic_transform();
 
+	void _reset_interpolation(const JPH::RVec3& p_position, const JPH::Quat& p_rotation);
+
 	void _update_group_filter();
 
 	void _update_joint_constraints();
 
 	void _update_possible_kinematic_contacts();
 
+	void _update_iterations();
+
 	void _destroy_joint_constraints();
 
 	void _exit_all_areas();
@@ -306,6 +345,8 @@ private:
 
 	void _joints_changed();
 
+	void _object_layer_changed() override;
+
 	void _transform_changed();
 
 	void _motion_changed();
@@ -316,7 +357,12 @@ private:
 
 	void _contact_reporting_changed();
 
-	LocalVector<RID> exceptions;
+	void _iterations_changed();
+
+	// This is kept sorted, with enough inline capacity for the handful of exceptions that a body
+	// usually has, since `JoltGroupFilter` checks it for every pair of bodies that the narrow-phase
+	// considers.
+	InlineVector<RID, 4> exceptions;
 
 	LocalVector<Contact> contacts;
 
@@ -342,12 +388,24 @@ private:
 
 	Vector3 gravity;
 
+	Vector3 area_gravity;
+
+	JPH::RVec3 previous_position = {};
+
+	JPH::RVec3 current_position = {};
+
+	JPH::Quat previous_rotation = JPH::Quat::sIdentity();
+
+	JPH::Quat current_rotation = JPH::Quat::sIdentity();
+
 	Callable state_sync_callback;
 
 	Callable custom_integration_callback;
 
 	JoltPhysicsDirectBodyState3DExtension* direct_state = nullptr;
 
+	JoltRagdollImpl3D* ragdoll = nullptr;
+
 	PhysicsServer3D::BodyMode mode = PhysicsServer3D::BODY_MODE_RIGID;
 
 	DampMode linear_damp_mode = PhysicsServer3D::BODY_DAMP_MODE_COMBINE;
@@ -364,12 +422,24 @@ private:
 
 	float total_angular_damp = 0.0f;
 
+	float area_linear_damp = 0.0f;
+
+	float area_angular_damp = 0.0f;
+
 	float gravity_scale = 1.0f;
 
 	float collision_priority = 1.0f;
 
+	uint64_t area_overrides_version = 0;
+
 	int32_t contact_count = 0;
 
+	int32_t velocity_iterations = 0;
+
+	int32_t position_iterations = 0;
+
+	int32_t ragdoll_bone = -1;
+
 	uint32_t locked_axes = 0;
 
 	bool sync_state = false;
@@ -377,4 +447,10 @@ private:
 	bool custom_center_of_mass = false;
 
 	bool custom_integrator = false;
+
+	bool area_gravity_uniform = false;
+
+	bool area_overrides_dirty = true;
+
+	bool contact_impulse_estimation = true;
 };
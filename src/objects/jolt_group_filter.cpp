@@ -42,6 +42,15 @@ bool JoltGroupFilter::CanCollide(
 		p_group2.GetSubGroupID()
 	);
 
+	// Pairs of bodies, like the bones of a ragdoll, make up the vast majority of what ends up here,
+	// so we check for those first, which lets us skip the double dispatch of the general case.
+	const JoltBodyImpl3D* body1 = object1->as_body();
+	const JoltBodyImpl3D* body2 = object2->as_body();
+
+	if (body1 != nullptr && body2 != nullptr) {
+		return body1->can_interact_with(*body2);
+	}
+
 	return object1->can_interact_with(*object2);
 }
 
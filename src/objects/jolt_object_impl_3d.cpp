@@ -28,7 +28,7 @@ Object* JoltObjectImpl3D::get_instance_wrapped() const {
 	return ObjectDB::get_instance(instance_id);
 }
 
-void JoltObjectImpl3D::set_space(JoltSpace3D* p_space) {
+void JoltObjectImpl3D::_set_space(JoltSpace3D* p_space, bool p_poolable) {
 	if (space == p_space) {
 		return;
 	}
@@ -36,7 +36,7 @@ void JoltObjectImpl3D::set_space(JoltSpace3D* p_space) {
 	_space_changing();
 
 	if (space != nullptr) {
-		_remove_from_space();
+		_remove_from_space(p_poolable);
 	}
 
 	space = p_space;
@@ -68,10 +68,10 @@ void JoltObjectImpl3D::set_collision_mask(uint32_t p_mask) {
 	_collision_mask_changed();
 }
 
-void JoltObjectImpl3D::_remove_from_space() {
+void JoltObjectImpl3D::_remove_from_space(bool p_poolable) {
 	QUIET_FAIL_COND(jolt_id.IsInvalid());
 
-	space->remove_body(jolt_id);
+	space->remove_body(jolt_id, p_poolable);
 
 	jolt_id = {};
 }
@@ -80,7 +80,7 @@ void JoltObjectImpl3D::_reset_space() {
 	ERR_FAIL_NULL(space);
 
 	_space_changing();
-	_remove_from_space();
+	_remove_from_space(false);
 	_add_to_space();
 	_space_changed();
 }
@@ -122,6 +122,8 @@ void JoltObjectImpl3D::_update_object_layer() {
 	}
 
 	space->get_body_iface().SetObjectLayer(jolt_id, _get_object_layer());
+
+	_object_layer_changed();
 }
 
 void JoltObjectImpl3D::_collision_layer_changed() {
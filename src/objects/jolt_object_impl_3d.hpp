@@ -82,7 +82,11 @@ public:
 
 	JoltSpace3D* get_space() const { return space; }
 
-	void set_space(JoltSpace3D* p_space);
+	void set_space(JoltSpace3D* p_space) { _set_space(p_space, false); }
+
+	// Unlike `set_space(nullptr)`, this lets the space keep the underlying body around for reuse,
+	// which is only safe when the object is about to be freed.
+	void remove_from_space_before_free() { _set_space(nullptr, true); }
 
 	bool in_space() const { return space != nullptr && !jolt_id.IsInvalid(); }
 
@@ -123,9 +127,11 @@ protected:
 
 	virtual JPH::ObjectLayer _get_object_layer() const = 0;
 
+	void _set_space(JoltSpace3D* p_space, bool p_poolable);
+
 	virtual void _add_to_space() = 0;
 
-	virtual void _remove_from_space();
+	virtual void _remove_from_space(bool p_poolable);
 
 	void _reset_space();
 
@@ -135,6 +141,8 @@ protected:
 
 	virtual void _collision_mask_changed();
 
+	virtual void _object_layer_changed() { }
+
 	virtual void _space_changing() { }
 
 	virtual void _space_changed() { }
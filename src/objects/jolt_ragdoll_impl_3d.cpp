@@ -0,0 +1,525 @@
+#include "jolt_ragdoll_impl_3d.hpp"
+
+#include "objects/jolt_body_impl_3d.hpp"
+#include "shapes/jolt_shape_impl_3d.hpp"
+#include "spaces/jolt_space_3d.hpp"
+
+namespace {
+
+// Transforms are packed the same way as the buffers of `RenderingServer.multimesh_set_buffer`, with
+// each row of the basis followed by the corresponding component of the origin.
+constexpr int32_t TRANSFORM_STRIDE = 12;
+
+constexpr double DEFAULT_SWING_SPAN = Math_PI / 4.0;
+constexpr double DEFAULT_TWIST_SPAN = Math_PI;
+
+Transform3D read_transform(const PackedFloat32Array& p_array, int32_t p_index) {
+	const float* data = p_array.ptr() + (ptrdiff_t)p_index * TRANSFORM_STRIDE;
+
+	Transform3D transform;
+	transform.basis.rows[0] = Vector3(data[0], data[1], data[2]);
+	transform.basis.rows[1] = Vector3(data[4], data[5], data[6]);
+	transform.basis.rows[2] = Vector3(data[8], data[9], data[10]);
+	transform.origin = Vector3(data[3], data[7], data[11]);
+
+	return transform;
+}
+
+Transform3D read_transform_or_identity(const PackedFloat32Array& p_array, int32_t p_index) {
+	return !p_array.is_empty() ? read_transform(p_array, p_index) : Transform3D();
+}
+
+void write_transform(PackedFloat32Array& p_array, int32_t p_index, const Transform3D& p_transform) {
+	float* data = p_array.ptrw() + (ptrdiff_t)p_index * TRANSFORM_STRIDE;
+
+	for (int32_t row = 0; row < 3; ++row) {
+		data[row * 4 + 0] = (float)p_transform.basis.rows[row].x;
+		data[row * 4 + 1] = (float)p_transform.basis.rows[row].y;
+		data[row * 4 + 2] = (float)p_transform.basis.rows[row].z;
+		data[row * 4 + 3] = (float)p_transform.origin[row];
+	}
+}
+
+} // namespace
+
+JoltRagdollImpl3D::~JoltRagdollImpl3D() {
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		_destroy_constraint(i);
+	}
+
+	for (Bone& bone : bones) {
+		if (bone.body != nullptr) {
+			bone.body->set_ragdoll(nullptr, -1);
+			bone.body->remove_from_space_before_free();
+			memdelete_safely(bone.body);
+		}
+	}
+}
+
+bool JoltRagdollImpl3D::build(
+	const Dictionary& p_skeleton,
+	const LocalVector<JoltShapeImpl3D*>& p_shapes,
+	const LocalVector<JoltBodyImpl3D*>& p_bodies
+) {
+	const int32_t bone_count = p_bodies.size();
+
+	// We take ownership of the bodies before validating anything, so that they get freed along with
+	// the ragdoll regardless of whether we succeed or not.
+	bones.resize(bone_count);
+
+	for (int32_t i = 0; i < bone_count; ++i) {
+		bones[i].body = p_bodies[i];
+	}
+
+	const PackedInt32Array parents = p_skeleton.get("parents", PackedInt32Array());
+	const PackedFloat32Array rest_pose = p_skeleton.get("rest_pose", PackedFloat32Array());
+	const PackedFloat32Array shape_transforms = p_skeleton.get(
+		"shape_transforms",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array joint_transforms = p_skeleton.get(
+		"joint_transforms",
+		PackedFloat32Array()
+	);
+	const PackedFloat32Array masses = p_skeleton.get("masses", PackedFloat32Array());
+	const PackedFloat32Array swing_spans = p_skeleton.get("swing_spans", PackedFloat32Array());
+	const PackedFloat32Array twist_spans = p_skeleton.get("twist_spans", PackedFloat32Array());
+
+	const int32_t transforms_size = bone_count * TRANSFORM_STRIDE;
+
+	ERR_FAIL_COND_D_MSG(
+		bone_count == 0,
+		"Failed to create ragdoll. The skeleton must have at least one bone."
+	);
+
+	ERR_FAIL_COND_D_MSG(
+		parents.size() != bone_count || p_shapes.size() != bone_count,
+		vformat(
+			"Failed to create ragdoll. "
+			"Expected %d parents and shapes, but got %d parents and %d shapes.",
+			bone_count,
+			parents.size(),
+			p_shapes.size()
+		)
+	);
+
+	ERR_FAIL_COND_D_MSG(
+		rest_pose.size() != transforms_size ||
+			(!shape_transforms.is_empty() && shape_transforms.size() != transforms_size) ||
+			(!joint_transforms.is_empty() && joint_transforms.size() != transforms_size),
+		vformat(
+			"Failed to create ragdoll. "
+			"Transform arrays must hold %d floats for a skeleton with %d bones.",
+			transforms_size,
+			bone_count
+		)
+	);
+
+	ERR_FAIL_COND_D_MSG(
+		(!masses.is_empty() && masses.size() != bone_count) ||
+			(!swing_spans.is_empty() && swing_spans.size() != bone_count) ||
+			(!twist_spans.is_empty() && twist_spans.size() != bone_count),
+		vformat(
+			"Failed to create ragdoll. "
+			"Per-bone arrays must hold %d values for a skeleton with %d bones.",
+			bone_count,
+			bone_count
+		)
+	);
+
+	for (int32_t i = 0; i < bone_count; ++i) {
+		ERR_FAIL_COND_D_MSG(
+			parents[i] < -1 || parents[i] >= i,
+			vformat(
+				"Failed to create ragdoll. "
+				"Bone %d has parent %d, but parents must be listed before their children.",
+				i,
+				parents[i]
+			)
+		);
+	}
+
+	// The bones stay regular bodies, since every body in a space needs to be backed by one of our
+	// objects, but everything else about the ragdoll is described to Jolt as a ragdoll, which lets
+	// it stabilize the bones, filter collisions between them and drive them using motors.
+	settings = new JPH::RagdollSettings();
+	settings->mSkeleton = new JPH::Skeleton();
+	settings->mParts.resize((size_t)bone_count);
+
+	LocalVector<JPH::Mat44> joint_matrices;
+	joint_matrices.resize(bone_count);
+
+	for (int32_t i = 0; i < bone_count; ++i) {
+		Bone& bone = bones[i];
+		bone.parent = parents[i];
+
+		const Transform3D shape_transform = read_transform_or_identity(shape_transforms, i);
+		const Transform3D rest_transform = read_transform(rest_pose, i);
+
+		bone.body->add_shape(p_shapes[i], shape_transform, false);
+		bone.body->set_transform(rest_transform);
+
+		if (!masses.is_empty()) {
+			bone.body->set_mass(masses[i]);
+		}
+
+		const JPH::ShapeRefC shape = p_shapes[i]->try_build();
+		ERR_FAIL_NULL_D(shape);
+
+		settings->mSkeleton->AddJoint("", bone.parent);
+
+		JPH::RagdollSettings::Part& part = settings->mParts[(size_t)i];
+		part.SetShape(JoltShapeImpl3D::with_basis_origin(
+			shape,
+			shape_transform.basis.orthonormalized(),
+			shape_transform.origin
+		));
+		part.mPosition = to_jolt_r(rest_transform.origin);
+		part.mRotation = to_jolt(rest_transform.basis);
+		part.mMotionType = JPH::EMotionType::Dynamic;
+		part.mOverrideMassProperties = JPH::EOverrideMassProperties::CalculateInertia;
+		part.mMassPropertiesOverride.mMass = bone.body->get_mass();
+
+		joint_matrices[i] = to_jolt(rest_transform);
+
+		if (bone.parent < 0) {
+			continue;
+		}
+
+		const Transform3D parent_rest = read_transform(rest_pose, bone.parent);
+		const Transform3D local_ref_b = read_transform_or_identity(joint_transforms, i);
+		const Transform3D local_ref_a = parent_rest.affine_inverse() * rest_transform * local_ref_b;
+
+		bone.local_ref_a = local_ref_a.orthonormalized();
+		bone.local_ref_b = local_ref_b.orthonormalized();
+
+		const double swing_span = !swing_spans.is_empty() ? swing_spans[i] : DEFAULT_SWING_SPAN;
+		const double twist_span = !twist_spans.is_empty() ? twist_spans[i] : DEFAULT_TWIST_SPAN;
+
+		// The positions and axes are filled in whenever the constraint is created, since they're
+		// relative to the center of mass of each body.
+		JPH::Ref<JPH::SwingTwistConstraintSettings>
+			constraint_settings = new JPH::SwingTwistConstraintSettings();
+		constraint_settings->mSpace = JPH::EConstraintSpace::LocalToBodyCOM;
+		constraint_settings->mSwingType = JPH::ESwingType::Pyramid;
+		constraint_settings->mNormalHalfConeAngle = (float)CLAMP(swing_span, 0.0, Math_PI);
+		constraint_settings->mPlaneHalfConeAngle = constraint_settings->mNormalHalfConeAngle;
+		constraint_settings->mTwistMaxAngle = (float)CLAMP(twist_span, 0.0, Math_PI);
+		constraint_settings->mTwistMinAngle = -constraint_settings->mTwistMaxAngle;
+
+		part.mToParent = constraint_settings;
+	}
+
+	LocalVector<JPH::MassProperties> old_mass_properties;
+	old_mass_properties.reserve(bone_count);
+
+	for (const JPH::RagdollSettings::Part& part : settings->mParts) {
+		old_mass_properties.push_back(part.GetMassProperties());
+	}
+
+	// Evening out the mass and inertia ratios between connected bones is what keeps long chains of
+	// them from jittering.
+	if (settings->Stabilize()) {
+		for (int32_t i = 0; i < bone_count; ++i) {
+			const JPH::MassProperties& old_properties = old_mass_properties[i];
+			const JPH::RagdollSettings::Part& part = settings->mParts[(size_t)i];
+			const JPH::MassProperties new_properties = part.GetMassProperties();
+
+			JoltBodyImpl3D* body = bones[i].body;
+
+			if (new_properties.mMass != old_properties.mMass) {
+				body->set_mass(new_properties.mMass);
+			}
+
+			// Bodies only support a diagonal inertia, so any products of inertia that come from
+			// rotated shapes are lost here, which is fine for the capsules and boxes that ragdolls
+			// are usually made of.
+			if (new_properties.mInertia != old_properties.mInertia) {
+				body->set_inertia(to_godot(new_properties.mInertia.GetDiagonal3()));
+			}
+		}
+	}
+
+	// This gives every bone its own sub-group in a group filter table, with collisions disabled
+	// between parents and their children, as well as between bones overlapping in the rest pose.
+	settings->DisableParentChildCollisions(joint_matrices.ptr());
+
+	group_filter = static_cast<const JPH::GroupFilterTable*>(
+		settings->mParts[0].mCollisionGroup.GetGroupFilter()
+	);
+
+	for (int32_t i = 0; i < bone_count; ++i) {
+		bones[i].body->set_ragdoll(this, i);
+	}
+
+	return true;
+}
+
+void JoltRagdollImpl3D::set_instance_id(ObjectID p_id) {
+	for (Bone& bone : bones) {
+		bone.body->set_instance_id(p_id);
+	}
+}
+
+JoltSpace3D* JoltRagdollImpl3D::get_space() const {
+	return !bones.is_empty() ? bones[0].body->get_space() : nullptr;
+}
+
+void JoltRagdollImpl3D::set_space(JoltSpace3D* p_space) {
+	// Bodies are only added to the broad-phase once the space steps or is queried, so the bones end
+	// up being inserted together rather than one at a time. Each constraint gets created once both
+	// of its bones have been moved to the new space.
+	for (Bone& bone : bones) {
+		bone.body->set_space(p_space);
+	}
+}
+
+TypedArray<RID> JoltRagdollImpl3D::get_bone_bodies() const {
+	TypedArray<RID> result;
+	result.resize(bones.size());
+
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		result[i] = bones[i].body->get_rid();
+	}
+
+	return result;
+}
+
+bool JoltRagdollImpl3D::can_bones_collide(int32_t p_bone1, int32_t p_bone2) const {
+	if (group_filter == nullptr) {
+		return true;
+	}
+
+	return group_filter->IsCollisionEnabled(
+		(JPH::CollisionGroup::SubGroupID)p_bone1,
+		(JPH::CollisionGroup::SubGroupID)p_bone2
+	);
+}
+
+void JoltRagdollImpl3D::set_collision_layer(uint32_t p_layer) {
+	for (Bone& bone : bones) {
+		bone.body->set_collision_layer(p_layer);
+	}
+}
+
+void JoltRagdollImpl3D::set_collision_mask(uint32_t p_mask) {
+	for (Bone& bone : bones) {
+		bone.body->set_collision_mask(p_mask);
+	}
+}
+
+void JoltRagdollImpl3D::set_kinematic(bool p_enabled) {
+	if (kinematic == p_enabled) {
+		return;
+	}
+
+	kinematic = p_enabled;
+
+	const PhysicsServer3D::BodyMode mode = kinematic
+		? PhysicsServer3D::BODY_MODE_KINEMATIC
+		: PhysicsServer3D::BODY_MODE_RIGID;
+
+	for (Bone& bone : bones) {
+		bone.body->set_mode(mode);
+	}
+}
+
+PackedFloat32Array JoltRagdollImpl3D::get_pose() const {
+	PackedFloat32Array pose;
+	pose.resize(bones.size() * TRANSFORM_STRIDE);
+
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		write_transform(pose, i, bones[i].body->get_transform_scaled());
+	}
+
+	return pose;
+}
+
+void JoltRagdollImpl3D::set_pose(const PackedFloat32Array& p_pose) {
+	QUIET_FAIL_COND(!_validate_pose(p_pose));
+
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		JoltBodyImpl3D* body = bones[i].body;
+		body->set_transform(read_transform(p_pose, i));
+		body->wake_up();
+	}
+}
+
+void JoltRagdollImpl3D::drive_to_pose_using_kinematics(const PackedFloat32Array& p_pose) {
+	ERR_FAIL_COND_MSG(
+		!kinematic,
+		"Failed to drive ragdoll using kinematics. The ragdoll must be kinematic."
+	);
+
+	QUIET_FAIL_COND(!_validate_pose(p_pose));
+
+	// Kinematic bodies move towards their new transform over the course of the next step
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		bones[i].body->set_transform(read_transform(p_pose, i));
+	}
+}
+
+void JoltRagdollImpl3D::drive_to_pose_using_motors(const PackedFloat32Array& p_pose) {
+	QUIET_FAIL_COND(!_validate_pose(p_pose));
+
+	motors_enabled = true;
+	motor_targets.resize(bones.size());
+
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		const Bone& bone = bones[i];
+
+		if (bone.parent < 0) {
+			continue;
+		}
+
+		const Basis parent_basis = read_transform(p_pose, bone.parent).basis.orthonormalized();
+		const Basis child_basis = read_transform(p_pose, i).basis.orthonormalized();
+
+		// This is the orientation of the bone relative to its parent, which is what Jolt's own
+		// ragdolls pass to `SetTargetOrientationBS` when driving their motors.
+		motor_targets[i] = to_jolt(parent_basis.transposed() * child_basis);
+
+		_update_motors(i);
+		bone.body->wake_up();
+	}
+}
+
+void JoltRagdollImpl3D::stop_motors() {
+	if (!motors_enabled) {
+		return;
+	}
+
+	motors_enabled = false;
+
+	for (int32_t i = 0; i < bones.size(); ++i) {
+		_update_motors(i);
+		bones[i].body->wake_up();
+	}
+}
+
+void JoltRagdollImpl3D::rebuild_bone_constraints(int32_t p_bone) {
+	_destroy_constraint(p_bone);
+	_build_constraint(p_bone);
+
+	for (int32_t i = p_bone + 1; i < bones.size(); ++i) {
+		if (bones[i].parent == p_bone) {
+			_destroy_constraint(i);
+			_build_constraint(i);
+		}
+	}
+}
+
+void JoltRagdollImpl3D::destroy_bone_constraints(int32_t p_bone) {
+	_destroy_constraint(p_bone);
+
+	for (int32_t i = p_bone + 1; i < bones.size(); ++i) {
+		if (bones[i].parent == p_bone) {
+			_destroy_constraint(i);
+		}
+	}
+}
+
+bool JoltRagdollImpl3D::_validate_pose(const PackedFloat32Array& p_pose) const {
+	const int32_t expected_size = bones.size() * TRANSFORM_STRIDE;
+
+	ERR_FAIL_COND_D_MSG(
+		p_pose.size() != expected_size,
+		vformat(
+			"Invalid pose passed to ragdoll with %d bones. Expected %d floats but got %d.",
+			bones.size(),
+			expected_size,
+			p_pose.size()
+		)
+	);
+
+	return true;
+}
+
+void JoltRagdollImpl3D::_build_constraint(int32_t p_bone) {
+	Bone& bone = bones[p_bone];
+
+	if (bone.parent < 0) {
+		return;
+	}
+
+	JoltBodyImpl3D* body_a = bones[bone.parent].body;
+	JoltBodyImpl3D* body_b = bone.body;
+
+	JoltSpace3D* space = body_b->get_space();
+
+	if (space == nullptr || body_a->get_space() != space) {
+		return;
+	}
+
+	const JPH::BodyID body_ids[2] = {body_a->get_jolt_id(), body_b->get_jolt_id()};
+	const JoltWritableBodies3D jolt_bodies = space->write_bodies(body_ids, count_of(body_ids));
+
+	auto* jolt_body_a = static_cast<JPH::Body*>(jolt_bodies[0]);
+	auto* jolt_body_b = static_cast<JPH::Body*>(jolt_bodies[1]);
+
+	ERR_FAIL_COND(jolt_body_a == nullptr || jolt_body_b == nullptr);
+
+	const Vector3 origin_a = bone.local_ref_a.origin * body_a->get_scale() -
+		to_godot(body_a->get_jolt_shape()->GetCenterOfMass());
+
+	const Vector3 origin_b = bone.local_ref_b.origin * body_b->get_scale() -
+		to_godot(body_b->get_jolt_shape()->GetCenterOfMass());
+
+	const Basis& basis_a = bone.local_ref_a.basis;
+	const Basis& basis_b = bone.local_ref_b.basis;
+
+	const auto& part_settings = static_cast<const JPH::SwingTwistConstraintSettings&>(
+		*settings->mParts[(size_t)p_bone].mToParent
+	);
+
+	JPH::SwingTwistConstraintSettings constraint_settings = part_settings;
+	constraint_settings.mPosition1 = to_jolt_r(origin_a);
+	constraint_settings.mTwistAxis1 = to_jolt(basis_a.get_column(Vector3::AXIS_X));
+	constraint_settings.mPlaneAxis1 = to_jolt(basis_a.get_column(Vector3::AXIS_Z));
+	constraint_settings.mPosition2 = to_jolt_r(origin_b);
+	constraint_settings.mTwistAxis2 = to_jolt(basis_b.get_column(Vector3::AXIS_X));
+	constraint_settings.mPlaneAxis2 = to_jolt(basis_b.get_column(Vector3::AXIS_Z));
+
+	bone.constraint = static_cast<JPH::SwingTwistConstraint*>(
+		constraint_settings.Create(*jolt_body_a, *jolt_body_b)
+	);
+
+	space->add_joint(bone.constraint);
+
+	_update_motors(p_bone);
+}
+
+void JoltRagdollImpl3D::_destroy_constraint(int32_t p_bone) {
+	Bone& bone = bones[p_bone];
+
+	if (bone.constraint == nullptr) {
+		return;
+	}
+
+	JoltSpace3D* space = bone.body->get_space();
+
+	if (space != nullptr) {
+		space->remove_joint(bone.constraint);
+	}
+
+	bone.constraint = nullptr;
+}
+
+void JoltRagdollImpl3D::_update_motors(int32_t p_bone) {
+	JPH::SwingTwistConstraint* constraint = bones[p_bone].constraint;
+
+	if (constraint == nullptr) {
+		return;
+	}
+
+	const JPH::EMotorState motor_state = motors_enabled
+		? JPH::EMotorState::Position
+		: JPH::EMotorState::Off;
+
+	constraint->SetSwingMotorState(motor_state);
+	constraint->SetTwistMotorState(motor_state);
+
+	if (motors_enabled) {
+		constraint->SetTargetOrientationBS(motor_targets[p_bone]);
+	}
+}
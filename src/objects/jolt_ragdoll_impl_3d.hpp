@@ -0,0 +1,93 @@
+#pragma once
+
+class JoltBodyImpl3D;
+class JoltShapeImpl3D;
+class JoltSpace3D;
+
+class JoltRagdollImpl3D {
+	struct Bone {
+		Transform3D local_ref_a;
+
+		Transform3D local_ref_b;
+
+		JoltBodyImpl3D* body = nullptr;
+
+		JPH::Ref<JPH::SwingTwistConstraint> constraint;
+
+		int32_t parent = -1;
+	};
+
+public:
+	JoltRagdollImpl3D() = default;
+
+	~JoltRagdollImpl3D();
+
+	bool build(
+		const Dictionary& p_skeleton,
+		const LocalVector<JoltShapeImpl3D*>& p_shapes,
+		const LocalVector<JoltBodyImpl3D*>& p_bodies
+	);
+
+	RID get_rid() const { return rid; }
+
+	void set_rid(const RID& p_rid) { rid = p_rid; }
+
+	void set_instance_id(ObjectID p_id);
+
+	JoltSpace3D* get_space() const;
+
+	void set_space(JoltSpace3D* p_space);
+
+	int32_t get_bone_count() const { return bones.size(); }
+
+	JoltBodyImpl3D* get_bone_body(int32_t p_index) const { return bones[p_index].body; }
+
+	TypedArray<RID> get_bone_bodies() const;
+
+	bool can_bones_collide(int32_t p_bone1, int32_t p_bone2) const;
+
+	void set_collision_layer(uint32_t p_layer);
+
+	void set_collision_mask(uint32_t p_mask);
+
+	bool is_kinematic() const { return kinematic; }
+
+	void set_kinematic(bool p_enabled);
+
+	PackedFloat32Array get_pose() const;
+
+	void set_pose(const PackedFloat32Array& p_pose);
+
+	void drive_to_pose_using_kinematics(const PackedFloat32Array& p_pose);
+
+	void drive_to_pose_using_motors(const PackedFloat32Array& p_pose);
+
+	void stop_motors();
+
+	void rebuild_bone_constraints(int32_t p_bone);
+
+	void destroy_bone_constraints(int32_t p_bone);
+
+private:
+	bool _validate_pose(const PackedFloat32Array& p_pose) const;
+
+	void _build_constraint(int32_t p_bone);
+
+	void _destroy_constraint(int32_t p_bone);
+
+	void _update_motors(int32_t p_bone);
+
+	LocalVector<Bone> bones;
+
+	JPH::Ref<JPH::RagdollSettings> settings;
+
+	JPH::RefConst<JPH::GroupFilterTable> group_filter;
+
+	LocalVector<JPH::Quat> motor_targets;
+
+	RID rid;
+
+	bool kinematic = false;
+
+	bool motors_enabled = false;
+};
@@ -1,5 +1,6 @@
 #include "jolt_shaped_object_impl_3d.hpp"
 
+#include "servers/jolt_allocation_tracker.hpp"
 #include "shapes/jolt_custom_double_sided_shape.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
@@ -131,6 +132,8 @@ AABB JoltShapedObjectImpl3D::get_aabb() const {
 }
 
 JPH::ShapeRefC JoltShapedObjectImpl3D::try_build_shape() {
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_SHAPES);
+
 	int32_t built_shapes = 0;
 
 	for (JoltShapeInstance3D& shape : shapes) {
@@ -3,6 +3,7 @@
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
 #include "objects/jolt_group_filter.hpp"
+#include "servers/jolt_allocation_tracker.hpp"
 #include "servers/jolt_project_settings.hpp"
 #include "spaces/jolt_broad_phase_layer.hpp"
 #include "spaces/jolt_space_3d.hpp"
@@ -67,7 +68,7 @@ bool JoltSoftBodyImpl3D::in_space() const {
 }
 
 void JoltSoftBodyImpl3D::add_collision_exception(const RID& p_excepted_body) {
-	exceptions.push_back(p_excepted_body);
+	exceptions.ordered_insert(p_excepted_body);
 
 	_exceptions_changed();
 }
@@ -79,7 +80,7 @@ void JoltSoftBodyImpl3D::remove_collision_exception(const RID& p_excepted_body)
 }
 
 bool JoltSoftBodyImpl3D::has_collision_exception(const RID& p_excepted_body) const {
-	return exceptions.find(p_excepted_body) >= 0;
+	return std::binary_search(exceptions.begin(), exceptions.end(), p_excepted_body);
 }
 
 TypedArray<RID> JoltSoftBodyImpl3D::get_collision_exceptions() const {
@@ -112,6 +113,12 @@ Vector3 JoltSoftBodyImpl3D::get_velocity_at_position([[maybe_unused]] const Vect
 	return {0.0f, 0.0f, 0.0f};
 }
 
+void JoltSoftBodyImpl3D::pre_step(float p_step, JPH::Body& p_jolt_body) {
+	JoltObjectImpl3D::pre_step(p_step, p_jolt_body);
+
+	_update_lod(p_jolt_body);
+}
+
 void JoltSoftBodyImpl3D::set_mesh(const RID& p_mesh) {
 	QUIET_FAIL_COND(mesh == p_mesh);
 
@@ -140,11 +147,24 @@ void JoltSoftBodyImpl3D::set_is_sleeping(bool p_enabled) {
 
 	JPH::BodyInterface& body_iface = space->get_body_iface();
 
+	if (!body_iface.IsAdded(jolt_id)) {
+		// Bodies that are still waiting to be added to the space will be activated once added, so
+		// there's nothing to wake up, but in order to put one to sleep we need to add it first.
+		if (!p_enabled) {
+			return;
+		}
+
+		space->add_pending_bodies();
+	}
+
 	if (p_enabled) {
 		body_iface.DeactivateBody(jolt_id);
 	} else {
 		body_iface.ActivateBody(jolt_id);
 	}
+
+	// Any explicit change in sleep state takes precedence over whatever the LOD did
+	lod_suspended = false;
 }
 
 void JoltSoftBodyImpl3D::set_simulation_precision(int32_t p_precision) {
@@ -475,6 +495,9 @@ JPH::ObjectLayer JoltSoftBodyImpl3D::_get_object_layer() const {
 void JoltSoftBodyImpl3D::_space_changing() {
 	JoltObjectImpl3D::_space_changing();
 
+	lod = JOLT_SOFT_BODY_LOD_FULL;
+	lod_suspended = false;
+
 	_deref_shared_data();
 
 	if (space != nullptr && !jolt_id.IsInvalid()) {
@@ -527,6 +550,8 @@ bool JoltSoftBodyImpl3D::_ref_shared_data() {
 	auto iter_shared_data = mesh_to_shared.find(mesh);
 
 	if (iter_shared_data == mesh_to_shared.end()) {
+		const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_SOFT_BODIES);
+
 		RenderingServer* rendering = RenderingServer::get_singleton();
 
 		const Array mesh_data = rendering->mesh_surface_get_arrays(mesh, 0);
@@ -704,8 +729,10 @@ void JoltSoftBodyImpl3D::_update_damping() {
 }
 
 void JoltSoftBodyImpl3D::_update_simulation_precision() {
+	const auto precision = (JPH::uint32)_get_effective_simulation_precision();
+
 	if (!in_space()) {
-		jolt_settings->mNumIterations = (JPH::uint32)simulation_precision;
+		jolt_settings->mNumIterations = precision;
 		return;
 	}
 
@@ -716,7 +743,53 @@ void JoltSoftBodyImpl3D::_update_simulation_precision() {
 		*body->GetMotionPropertiesUnchecked()
 	);
 
-	motion_properties.SetNumIterations((JPH::uint32)simulation_precision);
+	motion_properties.SetNumIterations(precision);
+}
+
+void JoltSoftBodyImpl3D::_update_lod(JPH::Body& p_jolt_body) {
+	lod = space->get_soft_body_lod(p_jolt_body.GetWorldSpaceBounds());
+
+	auto& motion_properties = static_cast<JPH::SoftBodyMotionProperties&>(
+		*p_jolt_body.GetMotionPropertiesUnchecked()
+	);
+
+	const auto precision = (JPH::uint32)_get_effective_simulation_precision();
+
+	if (motion_properties.GetNumIterations() != precision) {
+		motion_properties.SetNumIterations(precision);
+	}
+
+	const bool should_suspend = lod == JOLT_SOFT_BODY_LOD_FROZEN ||
+		(lod == JOLT_SOFT_BODY_LOD_SKIPPED && space->is_soft_body_step_skipped(jolt_id));
+
+	// Bodies stay deactivated for as long as they keep being skipped, so a body in the skip band is
+	// only activated for the one step out of every N that it runs, and deactivated once the next
+	// step skips it again, rather than being toggled on every step.
+	if (should_suspend == lod_suspended) {
+		return;
+	}
+
+	JPH::BodyInterface& body_iface = space->get_body_iface();
+
+	if (should_suspend) {
+		// We only take responsibility for bodies that were active to begin with, so that we don't
+		// end up waking up bodies that fell asleep on their own once they're back in range.
+		if (p_jolt_body.IsActive()) {
+			body_iface.DeactivateBody(jolt_id);
+			lod_suspended = true;
+		}
+	} else {
+		body_iface.ActivateBody(jolt_id);
+		lod_suspended = false;
+	}
+}
+
+int32_t JoltSoftBodyImpl3D::_get_effective_simulation_precision() const {
+	if (space == nullptr || lod == JOLT_SOFT_BODY_LOD_FULL) {
+		return simulation_precision;
+	}
+
+	return MIN(simulation_precision, space->get_soft_body_lod_precision());
 }
 
 void JoltSoftBodyImpl3D::_update_group_filter() {
@@ -744,6 +817,7 @@ void JoltSoftBodyImpl3D::_mesh_changed() {
 }
 
 void JoltSoftBodyImpl3D::_simulation_precision_changed() {
+	_update_simulation_precision();
 	wake_up();
 }
 
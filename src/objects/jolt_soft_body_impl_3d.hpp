@@ -1,6 +1,7 @@
 #pragma once
 
 #include "objects/jolt_object_impl_3d.hpp"
+#include "spaces/jolt_soft_body_lod.hpp"
 
 class JoltSpace3D;
 
@@ -38,6 +39,8 @@ public:
 
 	Vector3 get_velocity_at_position(const Vector3& p_position) const override;
 
+	void pre_step(float p_step, JPH::Body& p_jolt_body) override;
+
 	void set_mesh(const RID& p_mesh);
 
 	bool is_pickable() const { return pickable; }
@@ -125,6 +128,10 @@ private:
 
 	void _update_simulation_precision();
 
+	void _update_lod(JPH::Body& p_jolt_body);
+
+	int32_t _get_effective_simulation_precision() const;
+
 	void _update_group_filter();
 
 	void _try_rebuild();
@@ -149,7 +156,7 @@ private:
 
 	HashSet<int32_t> pinned_vertices;
 
-	LocalVector<RID> exceptions;
+	InlineVector<RID, 4> exceptions;
 
 	LocalVector<Vector3> normals;
 
@@ -168,4 +175,8 @@ private:
 	float stiffness_coefficient = 0.5f;
 
 	int32_t simulation_precision = 5;
+
+	JoltSoftBodyLOD lod = JOLT_SOFT_BODY_LOD_FULL;
+
+	bool lod_suspended = false;
 };
@@ -0,0 +1,322 @@
+#include "jolt_allocation_tracker.hpp"
+
+#ifdef GDJ_TRACK_ALLOCATIONS
+
+namespace {
+
+// Every allocation is prefixed with this header, which lets us know how much to subtract from which
+// tag when it's freed, without having to look it up anywhere. We keep it at 16 bytes so as to not
+// change the alignment of whatever the underlying allocator returns.
+struct AllocationHeader {
+	uint64_t size = 0;
+
+	uint32_t offset = 0;
+
+	JoltAllocationTag tag = JOLT_ALLOCATION_TAG_UNTAGGED;
+};
+
+constexpr size_t HEADER_SIZE = 16;
+
+static_assert(sizeof(AllocationHeader) <= HEADER_SIZE);
+
+struct TagCounters {
+	std::atomic<int64_t> live_bytes = 0;
+
+	std::atomic<int64_t> live_allocations = 0;
+
+	std::atomic<uint64_t> total_allocations = 0;
+
+	uint64_t allocations_at_last_step = 0;
+
+	uint64_t allocations_last_step = 0;
+};
+
+constexpr const char* TAG_NAMES[] = {
+	"Untagged",
+	"Physics System",
+	"Bodies",
+	"Soft Bodies",
+	"Shapes",
+	"Broad-Phase",
+	"Step",
+};
+
+static_assert(count_of(TAG_NAMES) == JOLT_ALLOCATION_TAG_COUNT);
+
+TagCounters counters[JOLT_ALLOCATION_TAG_COUNT];
+
+thread_local JoltAllocationTag current_tag = JOLT_ALLOCATION_TAG_UNTAGGED;
+
+JPH::AllocateFunction inner_allocate = nullptr;
+JPH::ReallocateFunction inner_reallocate = nullptr;
+JPH::FreeFunction inner_free = nullptr;
+JPH::AlignedAllocateFunction inner_aligned_allocate = nullptr;
+JPH::AlignedFreeFunction inner_aligned_free = nullptr;
+
+void track_allocation(JoltAllocationTag p_tag, uint64_t p_size) {
+	TagCounters& tag_counters = counters[p_tag];
+	tag_counters.live_bytes.fetch_add((int64_t)p_size, std::memory_order_relaxed);
+	tag_counters.live_allocations.fetch_add(1, std::memory_order_relaxed);
+	tag_counters.total_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void track_free(JoltAllocationTag p_tag, uint64_t p_size) {
+	TagCounters& tag_counters = counters[p_tag];
+	tag_counters.live_bytes.fetch_sub((int64_t)p_size, std::memory_order_relaxed);
+	tag_counters.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+AllocationHeader* get_header(void* p_mem) {
+	return reinterpret_cast<AllocationHeader*>(static_cast<uint8_t*>(p_mem) - HEADER_SIZE);
+}
+
+void* tracked_allocate(size_t p_size) {
+	auto* base = static_cast<uint8_t*>(inner_allocate(p_size + HEADER_SIZE));
+
+	if (base == nullptr) {
+		return nullptr;
+	}
+
+	void* mem = base + HEADER_SIZE;
+
+	AllocationHeader* header = new (get_header(mem)) AllocationHeader();
+	header->size = p_size;
+	header->offset = HEADER_SIZE;
+	header->tag = current_tag;
+
+	track_allocation(header->tag, p_size);
+
+	return mem;
+}
+
+void* tracked_reallocate(void* p_mem, size_t p_old_size, size_t p_new_size) {
+	if (p_mem == nullptr) {
+		return tracked_allocate(p_new_size);
+	}
+
+	// Reallocations are attributed to whoever made the original allocation, since that's more
+	// often than not what's growing
+	const AllocationHeader old_header = *get_header(p_mem);
+
+	auto* base = static_cast<uint8_t*>(inner_reallocate(
+		static_cast<uint8_t*>(p_mem) - HEADER_SIZE,
+		p_old_size + HEADER_SIZE,
+		p_new_size + HEADER_SIZE
+	));
+
+	if (base == nullptr) {
+		return nullptr;
+	}
+
+	void* mem = base + HEADER_SIZE;
+
+	get_header(mem)->size = p_new_size;
+
+	track_free(old_header.tag, old_header.size);
+	track_allocation(old_header.tag, p_new_size);
+
+	return mem;
+}
+
+void tracked_free(void* p_mem) {
+	if (p_mem == nullptr) {
+		return;
+	}
+
+	const AllocationHeader* header = get_header(p_mem);
+
+	track_free(header->tag, header->size);
+
+	inner_free(static_cast<uint8_t*>(p_mem) - HEADER_SIZE);
+}
+
+void* tracked_aligned_allocate(size_t p_size, size_t p_alignment) {
+	const size_t offset = MAX(p_alignment, HEADER_SIZE);
+
+	auto* base = static_cast<uint8_t*>(inner_aligned_allocate(p_size + offset, p_alignment));
+
+	if (base == nullptr) {
+		return nullptr;
+	}
+
+	void* mem = base + offset;
+
+	AllocationHeader* header = new (get_header(mem)) AllocationHeader();
+	header->size = p_size;
+	header->offset = (uint32_t)offset;
+	header->tag = current_tag;
+
+	track_allocation(header->tag, p_size);
+
+	return mem;
+}
+
+void tracked_aligned_free(void* p_mem) {
+	if (p_mem == nullptr) {
+		return;
+	}
+
+	const AllocationHeader* header = get_header(p_mem);
+
+	track_free(header->tag, header->size);
+
+	inner_aligned_free(static_cast<uint8_t*>(p_mem) - header->offset);
+}
+
+int64_t get_live_bytes(int64_t p_tag) {
+	return counters[p_tag].live_bytes.load(std::memory_order_relaxed);
+}
+
+int64_t get_allocations_last_step(int64_t p_tag) {
+	return (int64_t)counters[p_tag].allocations_last_step;
+}
+
+StringName get_monitor_name(const char* p_category, int32_t p_tag) {
+	return vformat("%s/%s", p_category, TAG_NAMES[p_tag]);
+}
+
+} // namespace
+
+void JoltAllocationTracker::install() {
+	// We wrap whatever allocator has already been registered, rather than picking one ourselves, so
+	// that this works the same regardless of whether we're using mimalloc or not.
+	inner_allocate = JPH::Allocate;
+	inner_reallocate = JPH::Reallocate;
+	inner_free = JPH::Free;
+	inner_aligned_allocate = JPH::AlignedAllocate;
+	inner_aligned_free = JPH::AlignedFree;
+
+	JPH::Allocate = &tracked_allocate;
+	JPH::Reallocate = &tracked_reallocate;
+	JPH::Free = &tracked_free;
+	JPH::AlignedAllocate = &tracked_aligned_allocate;
+	JPH::AlignedFree = &tracked_aligned_free;
+}
+
+JoltAllocationTag JoltAllocationTracker::get_current_tag() {
+	return current_tag;
+}
+
+void JoltAllocationTracker::set_current_tag(JoltAllocationTag p_tag) {
+	current_tag = p_tag;
+}
+
+void JoltAllocationTracker::register_monitors() {
+	Performance* performance = Performance::get_singleton();
+	ERR_FAIL_NULL(performance);
+
+	for (int32_t i = 0; i < JOLT_ALLOCATION_TAG_COUNT; ++i) {
+		Array arguments;
+		arguments.push_back(i);
+
+		performance->add_custom_monitor(
+			get_monitor_name("Jolt Memory", i),
+			callable_mp_static(&get_live_bytes),
+			arguments
+		);
+
+		performance->add_custom_monitor(
+			get_monitor_name("Jolt Allocations Per Step", i),
+			callable_mp_static(&get_allocations_last_step),
+			arguments
+		);
+	}
+}
+
+void JoltAllocationTracker::unregister_monitors() {
+	Performance* performance = Performance::get_singleton();
+
+	if (performance == nullptr) {
+		return;
+	}
+
+	for (int32_t i = 0; i < JOLT_ALLOCATION_TAG_COUNT; ++i) {
+		performance->remove_custom_monitor(get_monitor_name("Jolt Memory", i));
+		performance->remove_custom_monitor(get_monitor_name("Jolt Allocations Per Step", i));
+	}
+}
+
+void JoltAllocationTracker::step() {
+	for (TagCounters& tag_counters : counters) {
+		const uint64_t total_allocations = tag_counters.total_allocations.load(
+			std::memory_order_relaxed
+		);
+
+		tag_counters.allocations_last_step = total_allocations -
+			tag_counters.allocations_at_last_step;
+
+		tag_counters.allocations_at_last_step = total_allocations;
+	}
+}
+
+Dictionary JoltAllocationTracker::get_report() {
+	Dictionary report;
+
+	for (int32_t i = 0; i < JOLT_ALLOCATION_TAG_COUNT; ++i) {
+		const TagCounters& tag_counters = counters[i];
+
+		Dictionary entry;
+		entry["live_bytes"] = tag_counters.live_bytes.load(std::memory_order_relaxed);
+		entry["live_allocations"] = tag_counters.live_allocations.load(std::memory_order_relaxed);
+		entry["total_allocations"] = tag_counters.total_allocations.load(std::memory_order_relaxed);
+		entry["allocations_last_step"] = tag_counters.allocations_last_step;
+
+		report[TAG_NAMES[i]] = entry;
+	}
+
+	return report;
+}
+
+void JoltAllocationTracker::dump_report() {
+	int64_t total_live_bytes = 0;
+
+	UtilityFunctions::print("Jolt memory report:");
+
+	for (int32_t i = 0; i < JOLT_ALLOCATION_TAG_COUNT; ++i) {
+		const TagCounters& tag_counters = counters[i];
+
+		const int64_t live_bytes = tag_counters.live_bytes.load(std::memory_order_relaxed);
+
+		UtilityFunctions::print(vformat(
+			"  %s: %s in %d allocations (%d allocations total, %d during last step)",
+			TAG_NAMES[i],
+			String::humanize_size(live_bytes),
+			tag_counters.live_allocations.load(std::memory_order_relaxed),
+			tag_counters.total_allocations.load(std::memory_order_relaxed),
+			tag_counters.allocations_last_step
+		));
+
+		total_live_bytes += live_bytes;
+	}
+
+	UtilityFunctions::print(vformat("  Total: %s", String::humanize_size(total_live_bytes)));
+}
+
+#else // GDJ_TRACK_ALLOCATIONS
+
+void JoltAllocationTracker::install() { }
+
+JoltAllocationTag JoltAllocationTracker::get_current_tag() {
+	return JOLT_ALLOCATION_TAG_UNTAGGED;
+}
+
+void JoltAllocationTracker::set_current_tag([[maybe_unused]] JoltAllocationTag p_tag) { }
+
+void JoltAllocationTracker::register_monitors() { }
+
+void JoltAllocationTracker::unregister_monitors() { }
+
+void JoltAllocationTracker::step() { }
+
+Dictionary JoltAllocationTracker::get_report() {
+	return {};
+}
+
+void JoltAllocationTracker::dump_report() {
+	WARN_PRINT(
+		"Memory reports require Godot Jolt to be built with allocation tracking enabled. "
+		"Nothing will be reported."
+	);
+}
+
+#endif // GDJ_TRACK_ALLOCATIONS
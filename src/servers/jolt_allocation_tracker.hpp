@@ -0,0 +1,58 @@
+#pragma once
+
+enum JoltAllocationTag : uint8_t {
+	JOLT_ALLOCATION_TAG_UNTAGGED,
+	JOLT_ALLOCATION_TAG_PHYSICS_SYSTEM,
+	JOLT_ALLOCATION_TAG_BODIES,
+	JOLT_ALLOCATION_TAG_SOFT_BODIES,
+	JOLT_ALLOCATION_TAG_SHAPES,
+	JOLT_ALLOCATION_TAG_BROAD_PHASE,
+	JOLT_ALLOCATION_TAG_STEP,
+	JOLT_ALLOCATION_TAG_COUNT
+};
+
+class JoltAllocationTracker {
+public:
+	static void install();
+
+	static JoltAllocationTag get_current_tag();
+
+	static void set_current_tag(JoltAllocationTag p_tag);
+
+	static void register_monitors();
+
+	static void unregister_monitors();
+
+	static void step();
+
+	static Dictionary get_report();
+
+	static void dump_report();
+};
+
+class JoltAllocationScope {
+public:
+#ifdef GDJ_TRACK_ALLOCATIONS
+	explicit JoltAllocationScope(JoltAllocationTag p_tag)
+		: previous_tag(JoltAllocationTracker::get_current_tag()) {
+		JoltAllocationTracker::set_current_tag(p_tag);
+	}
+
+	~JoltAllocationScope() { JoltAllocationTracker::set_current_tag(previous_tag); }
+#else // GDJ_TRACK_ALLOCATIONS
+	explicit JoltAllocationScope([[maybe_unused]] JoltAllocationTag p_tag) { }
+#endif // GDJ_TRACK_ALLOCATIONS
+
+	JoltAllocationScope(const JoltAllocationScope& p_other) = delete;
+
+	JoltAllocationScope(JoltAllocationScope&& p_other) = delete;
+
+	JoltAllocationScope& operator=(const JoltAllocationScope& p_other) = delete;
+
+	JoltAllocationScope& operator=(JoltAllocationScope&& p_other) = delete;
+
+#ifdef GDJ_TRACK_ALLOCATIONS
+private:
+	JoltAllocationTag previous_tag = JOLT_ALLOCATION_TAG_UNTAGGED;
+#endif // GDJ_TRACK_ALLOCATIONS
+};
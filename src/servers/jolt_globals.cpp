@@ -1,6 +1,7 @@
 #include "jolt_globals.hpp"
 
 #include "objects/jolt_group_filter.hpp"
+#include "servers/jolt_allocation_tracker.hpp"
 #include "shapes/jolt_custom_double_sided_shape.hpp"
 #include "shapes/jolt_custom_ray_shape.hpp"
 #include "shapes/jolt_custom_user_data_shape.hpp"
@@ -68,6 +69,10 @@ void jolt_initialize() {
 	JPH::RegisterDefaultAllocator();
 #endif // GDJ_USE_MIMALLOC
 
+#ifdef GDJ_TRACK_ALLOCATIONS
+	JoltAllocationTracker::install();
+#endif // GDJ_TRACK_ALLOCATIONS
+
 #ifdef JPH_ENABLE_ASSERTS
 	JPH::Trace = &jolt_trace;
 	JPH::AssertFailed = &jolt_assert;
@@ -6,9 +6,12 @@
 #include "joints/jolt_joint_impl_3d.hpp"
 #include "joints/jolt_pin_joint_impl_3d.hpp"
 #include "joints/jolt_slider_joint_impl_3d.hpp"
+#include "joints/jolt_vehicle_impl_3d.hpp"
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
+#include "objects/jolt_ragdoll_impl_3d.hpp"
 #include "objects/jolt_soft_body_impl_3d.hpp"
+#include "servers/jolt_allocation_tracker.hpp"
 #include "shapes/jolt_box_shape_impl_3d.hpp"
 #include "shapes/jolt_capsule_shape_impl_3d.hpp"
 #include "shapes/jolt_concave_polygon_shape_impl_3d.hpp"
@@ -36,6 +39,93 @@ void JoltPhysicsServer3DExtension::_bind_methods() {
 	BIND_METHOD(JoltPhysicsServer3DExtension, space_dump_debug_snapshot, "space", "dir");
 #endif // GDJ_CONFIG_EDITOR
 
+	BIND_METHOD(JoltPhysicsServer3DExtension, get_memory_report);
+	BIND_METHOD(JoltPhysicsServer3DExtension, dump_memory_report);
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_is_contact_stream_enabled, "space");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_set_contact_stream_enabled, "space", "enabled");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_contact_stream, "space");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_is_deterministic, "space");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_set_deterministic, "space", "enabled");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_state_hash, "space");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_interpolated_transforms, "space", "fraction");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_shift_origin, "space", "offset");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_add_projectiles, "space", "positions", "velocities", "radius", "gravity_scale", "lifetime", "collision_mask");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_clear_projectiles, "space");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_projectiles, "space");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_projectile_hits, "space");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_intersect_aabb, "space", "aabb", "collision_mask", "collide_with_bodies", "collide_with_areas");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_intersect_sphere, "space", "center", "radius", "collision_mask", "collide_with_bodies", "collide_with_areas");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_max_pooled_bodies, "space");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_set_max_pooled_bodies, "space", "count");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_capacity, "space", "capacity");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_set_capacity, "space", "capacity", "value");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_save_state, "space", "base");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_restore_state, "space", "state", "base");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, area_set_batched_monitor_callback, "area", "callback");
+	BIND_METHOD(JoltPhysicsServer3DExtension, area_set_batched_area_monitor_callback, "area", "callback");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_soft_body_lod_reference, "space");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_set_soft_body_lod_reference, "space", "position");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_get_soft_body_lod_param, "space", "param");
+	BIND_METHOD(JoltPhysicsServer3DExtension, space_set_soft_body_lod_param, "space", "param", "value");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, body_get_solver_velocity_iterations, "body");
+	BIND_METHOD(JoltPhysicsServer3DExtension, body_set_solver_velocity_iterations, "body", "value");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, body_get_solver_position_iterations, "body");
+	BIND_METHOD(JoltPhysicsServer3DExtension, body_set_solver_position_iterations, "body", "value");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, body_get_contact_impulse_estimation, "body");
+	BIND_METHOD(JoltPhysicsServer3DExtension, body_set_contact_impulse_estimation, "body", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_create, "skeleton");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_get_space, "ragdoll");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_set_space, "ragdoll", "space");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_attach_object_instance_id, "ragdoll", "id");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_set_collision_layer, "ragdoll", "layer");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_set_collision_mask, "ragdoll", "mask");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_get_bone_count, "ragdoll");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_get_bone_bodies, "ragdoll");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_is_kinematic, "ragdoll");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_set_kinematic, "ragdoll", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_get_pose, "ragdoll");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_set_pose, "ragdoll", "pose");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_drive_to_pose_using_kinematics, "ragdoll", "pose");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_drive_to_pose_using_motors, "ragdoll", "pose");
+	BIND_METHOD(JoltPhysicsServer3DExtension, ragdoll_stop_motors, "ragdoll");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_create, "body", "settings");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_get_body, "vehicle");
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_get_wheel_count, "vehicle");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_set_driver_input, "vehicle", "forward", "right", "brake", "hand_brake");
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_set_driver_inputs, "vehicles", "inputs");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_get_wheel_states, "vehicle");
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_get_wheel_transforms, "vehicle");
+
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_get_engine_rpm, "vehicle");
+	BIND_METHOD(JoltPhysicsServer3DExtension, vehicle_get_current_gear, "vehicle");
+
 	BIND_METHOD(JoltPhysicsServer3DExtension, joint_get_enabled, "joint");
 	BIND_METHOD(JoltPhysicsServer3DExtension, joint_set_enabled, "joint", "enabled");
 
@@ -85,6 +175,16 @@ void JoltPhysicsServer3DExtension::_bind_methods() {
 
 	// clang-format on
 
+	BIND_ENUM_CONSTANT(SPACE_SOFT_BODY_LOD_REDUCE_DISTANCE);
+	BIND_ENUM_CONSTANT(SPACE_SOFT_BODY_LOD_SKIP_DISTANCE);
+	BIND_ENUM_CONSTANT(SPACE_SOFT_BODY_LOD_FREEZE_DISTANCE);
+	BIND_ENUM_CONSTANT(SPACE_SOFT_BODY_LOD_PRECISION);
+	BIND_ENUM_CONSTANT(SPACE_SOFT_BODY_LOD_SKIP_INTERVAL);
+
+	BIND_ENUM_CONSTANT(SPACE_CAPACITY_MAX_BODIES);
+	BIND_ENUM_CONSTANT(SPACE_CAPACITY_MAX_BODY_PAIRS);
+	BIND_ENUM_CONSTANT(SPACE_CAPACITY_MAX_CONTACT_CONSTRAINTS);
+
 	BIND_ENUM_CONSTANT(HINGE_JOINT_LIMIT_SPRING_FREQUENCY);
 	BIND_ENUM_CONSTANT(HINGE_JOINT_LIMIT_SPRING_DAMPING);
 	BIND_ENUM_CONSTANT(HINGE_JOINT_MOTOR_MAX_TORQUE);
@@ -319,7 +419,8 @@ real_t JoltPhysicsServer3DExtension::_space_get_param(const RID& p_space, SpaceP
 
 PhysicsDirectSpaceState3D* JoltPhysicsServer3DExtension::_space_get_direct_state(const RID& p_space
 ) {
-	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	// The direct state is commonly fetched from the same worker threads that end up querying it
+	JoltSpace3D* space = get_space_for_query(p_space);
 	ERR_FAIL_NULL_D(space);
 
 	return space->get_direct_state();
@@ -1964,6 +2065,10 @@ void JoltPhysicsServer3DExtension::_free_rid(const RID& p_rid) {
 		free_area(area);
 	} else if (JoltSoftBodyImpl3D* soft_body = soft_body_owner.get_or_null(p_rid)) {
 		free_soft_body(soft_body);
+	} else if (JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_rid)) {
+		free_ragdoll(ragdoll);
+	} else if (JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_rid)) {
+		free_vehicle(vehicle);
 	} else if (JoltSpace3D* space = space_owner.get_or_null(p_rid)) {
 		free_space(space);
 	} else {
@@ -1977,6 +2082,8 @@ void JoltPhysicsServer3DExtension::_set_active(bool p_active) {
 
 void JoltPhysicsServer3DExtension::_init() {
 	job_system = new JoltJobSystem();
+
+	JoltAllocationTracker::register_monitors();
 }
 
 void JoltPhysicsServer3DExtension::_step(real_t p_step) {
@@ -1991,6 +2098,26 @@ void JoltPhysicsServer3DExtension::_step(real_t p_step) {
 
 		job_system->post_step();
 	}
+
+	JoltAllocationTracker::step();
+}
+
+void JoltPhysicsServer3DExtension::_sync() {
+	if (active) {
+		// Any space that's being stepped will have its broad-phase rebuilt as part of the step
+		return;
+	}
+
+	// When we're not being stepped, like in the editor, we instead take this opportunity to optimize
+	// the broad-phase of any space that has had bodies added to it, so that this doesn't need to
+	// happen as part of a query. We limit this to one broad-phase layer of one space per tick to
+	// bound the amount of work.
+	for (JoltSpace3D* space : active_spaces) {
+		if (space->needs_optimizing()) {
+			space->optimize_incrementally();
+			break;
+		}
+	}
 }
 
 void JoltPhysicsServer3DExtension::_flush_queries() {
@@ -2012,6 +2139,8 @@ void JoltPhysicsServer3DExtension::_flush_queries() {
 }
 
 void JoltPhysicsServer3DExtension::_finish() {
+	JoltAllocationTracker::unregister_monitors();
+
 	delete_safely(job_system);
 }
 
@@ -2044,7 +2173,15 @@ void JoltPhysicsServer3DExtension::free_area(JoltAreaImpl3D* p_area) {
 void JoltPhysicsServer3DExtension::free_body(JoltBodyImpl3D* p_body) {
 	ERR_FAIL_NULL(p_body);
 
-	p_body->set_space(nullptr);
+	ERR_FAIL_COND_MSG(
+		p_body->get_ragdoll() != nullptr,
+		vformat(
+			"Failed to free '%s'. Bodies that make up a ragdoll are freed along with the ragdoll.",
+			p_body->to_string()
+		)
+	);
+
+	p_body->remove_from_space_before_free();
 	body_owner.free(p_body->get_rid());
 	memdelete_safely(p_body);
 }
@@ -2072,6 +2209,29 @@ void JoltPhysicsServer3DExtension::free_joint(JoltJointImpl3D* p_joint) {
 	memdelete_safely(p_joint);
 }
 
+void JoltPhysicsServer3DExtension::free_ragdoll(JoltRagdollImpl3D* p_ragdoll) {
+	ERR_FAIL_NULL(p_ragdoll);
+
+	// The bodies that make up the bones are owned by the ragdoll, and are freed along with it
+	for (int32_t i = 0; i < p_ragdoll->get_bone_count(); ++i) {
+		body_owner.free(p_ragdoll->get_bone_body(i)->get_rid());
+	}
+
+	// A ragdoll that failed to build never got a RID of its own
+	if (p_ragdoll->get_rid().is_valid()) {
+		ragdoll_owner.free(p_ragdoll->get_rid());
+	}
+
+	memdelete_safely(p_ragdoll);
+}
+
+void JoltPhysicsServer3DExtension::free_vehicle(JoltVehicleImpl3D* p_vehicle) {
+	ERR_FAIL_NULL(p_vehicle);
+
+	vehicle_owner.free(p_vehicle->get_rid());
+	memdelete_safely(p_vehicle);
+}
+
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltPhysicsServer3DExtension::dump_debug_snapshots(const String& p_dir) {
@@ -2092,6 +2252,593 @@ void JoltPhysicsServer3DExtension::space_dump_debug_snapshot(
 
 #endif // GDJ_CONFIG_EDITOR
 
+Dictionary JoltPhysicsServer3DExtension::get_memory_report() const {
+	return JoltAllocationTracker::get_report();
+}
+
+void JoltPhysicsServer3DExtension::dump_memory_report() const {
+	JoltAllocationTracker::dump_report();
+}
+
+bool JoltPhysicsServer3DExtension::space_is_contact_stream_enabled(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->is_contact_stream_enabled();
+}
+
+void JoltPhysicsServer3DExtension::space_set_contact_stream_enabled(
+	const RID& p_space,
+	bool p_enabled
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_contact_stream_enabled(p_enabled);
+}
+
+Dictionary JoltPhysicsServer3DExtension::space_get_contact_stream(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_contact_stream();
+}
+
+bool JoltPhysicsServer3DExtension::space_is_deterministic(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->is_deterministic();
+}
+
+void JoltPhysicsServer3DExtension::space_set_deterministic(const RID& p_space, bool p_enabled) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_deterministic(p_enabled);
+}
+
+int64_t JoltPhysicsServer3DExtension::space_get_state_hash(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_state_hash();
+}
+
+Dictionary JoltPhysicsServer3DExtension::space_get_interpolated_transforms(
+	const RID& p_space,
+	double p_fraction
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_interpolated_transforms((float)CLAMP(p_fraction, 0.0, 1.0));
+}
+
+void JoltPhysicsServer3DExtension::space_shift_origin(const RID& p_space, const Vector3& p_offset) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->shift_origin(p_offset);
+}
+
+int64_t JoltPhysicsServer3DExtension::space_add_projectiles(
+	const RID& p_space,
+	const PackedVector3Array& p_positions,
+	const PackedVector3Array& p_velocities,
+	float p_radius,
+	float p_gravity_scale,
+	float p_lifetime,
+	uint32_t p_collision_mask
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, -1);
+
+	return space->add_projectiles(
+		p_positions,
+		p_velocities,
+		p_radius,
+		p_gravity_scale,
+		p_lifetime,
+		p_collision_mask
+	);
+}
+
+void JoltPhysicsServer3DExtension::space_clear_projectiles(const RID& p_space) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->clear_projectiles();
+}
+
+Dictionary JoltPhysicsServer3DExtension::space_get_projectiles(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_projectiles();
+}
+
+Dictionary JoltPhysicsServer3DExtension::space_get_projectile_hits(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_projectile_hits();
+}
+
+PackedInt64Array JoltPhysicsServer3DExtension::space_intersect_aabb(
+	const RID& p_space,
+	const AABB& p_aabb,
+	uint32_t p_collision_mask,
+	bool p_collide_with_bodies,
+	bool p_collide_with_areas
+) const {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_direct_state()->intersect_aabb(
+		p_aabb,
+		p_collision_mask,
+		p_collide_with_bodies,
+		p_collide_with_areas
+	);
+}
+
+PackedInt64Array JoltPhysicsServer3DExtension::space_intersect_sphere(
+	const RID& p_space,
+	const Vector3& p_center,
+	float p_radius,
+	uint32_t p_collision_mask,
+	bool p_collide_with_bodies,
+	bool p_collide_with_areas
+) const {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_direct_state()->intersect_sphere(
+		p_center,
+		p_radius,
+		p_collision_mask,
+		p_collide_with_bodies,
+		p_collide_with_areas
+	);
+}
+
+int32_t JoltPhysicsServer3DExtension::space_get_max_pooled_bodies(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_max_pooled_bodies();
+}
+
+void JoltPhysicsServer3DExtension::space_set_max_pooled_bodies(
+	const RID& p_space,
+	int32_t p_count
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_max_pooled_bodies(p_count);
+}
+
+int32_t JoltPhysicsServer3DExtension::space_get_capacity(
+	const RID& p_space,
+	SpaceCapacityJolt p_capacity
+) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_capacity(p_capacity);
+}
+
+void JoltPhysicsServer3DExtension::space_set_capacity(
+	const RID& p_space,
+	SpaceCapacityJolt p_capacity,
+	int32_t p_value
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_capacity(p_capacity, p_value);
+}
+
+PackedByteArray JoltPhysicsServer3DExtension::space_save_state(
+	const RID& p_space,
+	const PackedByteArray& p_base
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->save_state(p_base);
+}
+
+bool JoltPhysicsServer3DExtension::space_restore_state(
+	const RID& p_space,
+	const PackedByteArray& p_state,
+	const PackedByteArray& p_base
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->restore_state(p_state, p_base);
+}
+
+void JoltPhysicsServer3DExtension::area_set_batched_monitor_callback(
+	const RID& p_area,
+	const Callable& p_callback
+) {
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_batched_body_monitor_callback(p_callback);
+}
+
+void JoltPhysicsServer3DExtension::area_set_batched_area_monitor_callback(
+	const RID& p_area,
+	const Callable& p_callback
+) {
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_batched_area_monitor_callback(p_callback);
+}
+
+Vector3 JoltPhysicsServer3DExtension::space_get_soft_body_lod_reference(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_soft_body_lod_reference();
+}
+
+void JoltPhysicsServer3DExtension::space_set_soft_body_lod_reference(
+	const RID& p_space,
+	const Vector3& p_position
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_soft_body_lod_reference(p_position);
+}
+
+double JoltPhysicsServer3DExtension::space_get_soft_body_lod_param(
+	const RID& p_space,
+	SpaceSoftBodyLODParamJolt p_param
+) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_soft_body_lod_param(p_param);
+}
+
+void JoltPhysicsServer3DExtension::space_set_soft_body_lod_param(
+	const RID& p_space,
+	SpaceSoftBodyLODParamJolt p_param,
+	double p_value
+) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_soft_body_lod_param(p_param, p_value);
+}
+
+int32_t JoltPhysicsServer3DExtension::body_get_solver_velocity_iterations(const RID& p_body
+) const {
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->get_solver_velocity_iterations();
+}
+
+void JoltPhysicsServer3DExtension::body_set_solver_velocity_iterations(
+	const RID& p_body,
+	int32_t p_value
+) {
+	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_solver_velocity_iterations(p_value);
+}
+
+int32_t JoltPhysicsServer3DExtension::body_get_solver_position_iterations(const RID& p_body
+) const {
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->get_solver_position_iterations();
+}
+
+void JoltPhysicsServer3DExtension::body_set_solver_position_iterations(
+	const RID& p_body,
+	int32_t p_value
+) {
+	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_solver_position_iterations(p_value);
+}
+
+bool JoltPhysicsServer3DExtension::body_get_contact_impulse_estimation(const RID& p_body) const {
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->estimates_contact_impulses();
+}
+
+void JoltPhysicsServer3DExtension::body_set_contact_impulse_estimation(
+	const RID& p_body,
+	bool p_enabled
+) {
+	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL(body);
+
+	body->set_contact_impulse_estimation(p_enabled);
+}
+
+RID JoltPhysicsServer3DExtension::ragdoll_create(const Dictionary& p_skeleton) {
+	const Array shape_rids = p_skeleton.get("shapes", Array());
+	const PackedInt32Array parents = p_skeleton.get("parents", PackedInt32Array());
+
+	LocalVector<JoltShapeImpl3D*> shapes;
+	shapes.reserve((uint32_t)shape_rids.size());
+
+	for (int32_t i = 0; i < shape_rids.size(); ++i) {
+		JoltShapeImpl3D* shape = shape_owner.get_or_null(shape_rids[i]);
+		ERR_FAIL_NULL_D(shape);
+
+		shapes.push_back(shape);
+	}
+
+	LocalVector<JoltBodyImpl3D*> bodies;
+	bodies.reserve((uint32_t)parents.size());
+
+	for (int32_t i = 0; i < parents.size(); ++i) {
+		JoltBodyImpl3D* body = memnew(JoltBodyImpl3D);
+		RID rid = body_owner.make_rid(body);
+		body->set_rid(rid);
+		bodies.push_back(body);
+	}
+
+	JoltRagdollImpl3D* ragdoll = memnew(JoltRagdollImpl3D);
+
+	if (!ragdoll->build(p_skeleton, shapes, bodies)) {
+		free_ragdoll(ragdoll);
+		return {};
+	}
+
+	RID rid = ragdoll_owner.make_rid(ragdoll);
+	ragdoll->set_rid(rid);
+	return rid;
+}
+
+RID JoltPhysicsServer3DExtension::ragdoll_get_space(const RID& p_ragdoll) const {
+	const JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL_D(ragdoll);
+
+	const JoltSpace3D* space = ragdoll->get_space();
+
+	if (space == nullptr) {
+		return {};
+	}
+
+	return space->get_rid();
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_set_space(const RID& p_ragdoll, const RID& p_space) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	JoltSpace3D* space = nullptr;
+
+	if (p_space.is_valid()) {
+		space = space_owner.get_or_null(p_space);
+		ERR_FAIL_NULL(space);
+	}
+
+	ragdoll->set_space(space);
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_attach_object_instance_id(
+	const RID& p_ragdoll,
+	uint64_t p_id
+) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->set_instance_id(ObjectID(p_id));
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_set_collision_layer(
+	const RID& p_ragdoll,
+	uint32_t p_layer
+) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->set_collision_layer(p_layer);
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_set_collision_mask(
+	const RID& p_ragdoll,
+	uint32_t p_mask
+) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->set_collision_mask(p_mask);
+}
+
+int32_t JoltPhysicsServer3DExtension::ragdoll_get_bone_count(const RID& p_ragdoll) const {
+	const JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL_D(ragdoll);
+
+	return ragdoll->get_bone_count();
+}
+
+TypedArray<RID> JoltPhysicsServer3DExtension::ragdoll_get_bone_bodies(const RID& p_ragdoll) const {
+	const JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL_D(ragdoll);
+
+	return ragdoll->get_bone_bodies();
+}
+
+bool JoltPhysicsServer3DExtension::ragdoll_is_kinematic(const RID& p_ragdoll) const {
+	const JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL_D(ragdoll);
+
+	return ragdoll->is_kinematic();
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_set_kinematic(const RID& p_ragdoll, bool p_enabled) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->set_kinematic(p_enabled);
+}
+
+PackedFloat32Array JoltPhysicsServer3DExtension::ragdoll_get_pose(const RID& p_ragdoll) const {
+	const JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL_D(ragdoll);
+
+	return ragdoll->get_pose();
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_set_pose(
+	const RID& p_ragdoll,
+	const PackedFloat32Array& p_pose
+) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->set_pose(p_pose);
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_drive_to_pose_using_kinematics(
+	const RID& p_ragdoll,
+	const PackedFloat32Array& p_pose
+) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->drive_to_pose_using_kinematics(p_pose);
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_drive_to_pose_using_motors(
+	const RID& p_ragdoll,
+	const PackedFloat32Array& p_pose
+) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->drive_to_pose_using_motors(p_pose);
+}
+
+void JoltPhysicsServer3DExtension::ragdoll_stop_motors(const RID& p_ragdoll) {
+	JoltRagdollImpl3D* ragdoll = ragdoll_owner.get_or_null(p_ragdoll);
+	ERR_FAIL_NULL(ragdoll);
+
+	ragdoll->stop_motors();
+}
+
+RID JoltPhysicsServer3DExtension::vehicle_create(const RID& p_body, const Dictionary& p_settings) {
+	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	JoltVehicleImpl3D* vehicle = memnew(JoltVehicleImpl3D(body));
+
+	if (!vehicle->build(p_settings)) {
+		memdelete_safely(vehicle);
+		return {};
+	}
+
+	RID rid = vehicle_owner.make_rid(vehicle);
+	vehicle->set_rid(rid);
+	return rid;
+}
+
+RID JoltPhysicsServer3DExtension::vehicle_get_body(const RID& p_vehicle) const {
+	const JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL_D(vehicle);
+
+	return vehicle->get_chassis()->get_rid();
+}
+
+int32_t JoltPhysicsServer3DExtension::vehicle_get_wheel_count(const RID& p_vehicle) const {
+	const JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL_D(vehicle);
+
+	return vehicle->get_wheel_count();
+}
+
+void JoltPhysicsServer3DExtension::vehicle_set_driver_input(
+	const RID& p_vehicle,
+	float p_forward,
+	float p_right,
+	float p_brake,
+	float p_hand_brake
+) {
+	JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL(vehicle);
+
+	vehicle->set_driver_input(p_forward, p_right, p_brake, p_hand_brake);
+}
+
+void JoltPhysicsServer3DExtension::vehicle_set_driver_inputs(
+	const TypedArray<RID>& p_vehicles,
+	const PackedFloat32Array& p_inputs
+) {
+	const int32_t vehicle_count = p_vehicles.size();
+
+	ERR_FAIL_COND_MSG(
+		p_inputs.size() != (int64_t)vehicle_count * 4,
+		vformat(
+			"Failed to set driver inputs. Expected %d floats for %d vehicles, but got %d.",
+			vehicle_count * 4,
+			vehicle_count,
+			p_inputs.size()
+		)
+	);
+
+	const float* inputs = p_inputs.ptr();
+
+	for (int32_t i = 0; i < vehicle_count; ++i, inputs += 4) {
+		JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicles[i]);
+		ERR_CONTINUE(vehicle == nullptr);
+
+		vehicle->set_driver_input(inputs[0], inputs[1], inputs[2], inputs[3]);
+	}
+}
+
+PackedFloat32Array JoltPhysicsServer3DExtension::vehicle_get_wheel_states(
+	const RID& p_vehicle
+) const {
+	const JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL_D(vehicle);
+
+	return vehicle->get_wheel_states();
+}
+
+PackedFloat32Array JoltPhysicsServer3DExtension::vehicle_get_wheel_transforms(
+	const RID& p_vehicle
+) const {
+	const JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL_D(vehicle);
+
+	return vehicle->get_wheel_transforms();
+}
+
+float JoltPhysicsServer3DExtension::vehicle_get_engine_rpm(const RID& p_vehicle) const {
+	const JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL_D(vehicle);
+
+	return vehicle->get_engine_rpm();
+}
+
+int32_t JoltPhysicsServer3DExtension::vehicle_get_current_gear(const RID& p_vehicle) const {
+	const JoltVehicleImpl3D* vehicle = vehicle_owner.get_or_null(p_vehicle);
+	ERR_FAIL_NULL_D(vehicle);
+
+	return vehicle->get_current_gear();
+}
+
 bool JoltPhysicsServer3DExtension::joint_get_enabled(const RID& p_joint) const {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
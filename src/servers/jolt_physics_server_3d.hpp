@@ -1,17 +1,26 @@
 #pragma once
 
+#include "spaces/jolt_soft_body_lod.hpp"
+#include "spaces/jolt_space_capacity.hpp"
+
 class JoltAreaImpl3D;
 class JoltBodyImpl3D;
 class JoltJobSystem;
 class JoltJointImpl3D;
+class JoltRagdollImpl3D;
 class JoltShapeImpl3D;
 class JoltSoftBodyImpl3D;
 class JoltSpace3D;
+class JoltVehicleImpl3D;
 
 class JoltPhysicsServer3DExtension final : public PhysicsServer3DExtension {
 	GDCLASS_QUIET(JoltPhysicsServer3DExtension, PhysicsServer3DExtension)
 
 public:
+	using SpaceSoftBodyLODParamJolt = JoltSpaceSoftBodyLODParam;
+
+	using SpaceCapacityJolt = JoltSpaceCapacity;
+
 	enum HingeJointParamJolt {
 		HINGE_JOINT_LIMIT_SPRING_FREQUENCY = 100,
 		HINGE_JOINT_LIMIT_SPRING_DAMPING,
@@ -594,7 +603,7 @@ public:
 
 	void _step(real_t p_step) override;
 
-	void _sync() override { }
+	void _sync() override;
 
 	void _flush_queries() override;
 
@@ -620,6 +629,10 @@ public:
 
 	void free_joint(JoltJointImpl3D* p_joint);
 
+	void free_ragdoll(JoltRagdollImpl3D* p_ragdoll);
+
+	void free_vehicle(JoltVehicleImpl3D* p_vehicle);
+
 	JoltSpace3D* get_space(const RID& p_rid) const { return space_owner.get_or_null(p_rid); }
 
 	JoltAreaImpl3D* get_area(const RID& p_rid) const { return area_owner.get_or_null(p_rid); }
@@ -630,12 +643,193 @@ public:
 
 	JoltJointImpl3D* get_joint(const RID& p_rid) const { return joint_owner.get_or_null(p_rid); }
 
+	// Queries can run on any thread, so unlike the getters above these lock the owner while looking
+	// up the RID, in case the main thread is creating or freeing RIDs at the same time.
+
+	JoltAreaImpl3D* get_area_for_query(const RID& p_rid) const {
+		const auto read_lock = area_owner.lock_for_reading();
+		return area_owner.get_or_null(p_rid);
+	}
+
+	JoltBodyImpl3D* get_body_for_query(const RID& p_rid) const {
+		const auto read_lock = body_owner.lock_for_reading();
+		return body_owner.get_or_null(p_rid);
+	}
+
+	JoltShapeImpl3D* get_shape_for_query(const RID& p_rid) const {
+		const auto read_lock = shape_owner.lock_for_reading();
+		return shape_owner.get_or_null(p_rid);
+	}
+
+	JoltSpace3D* get_space_for_query(const RID& p_rid) const {
+		const auto read_lock = space_owner.lock_for_reading();
+		return space_owner.get_or_null(p_rid);
+	}
+
 #ifdef GDJ_CONFIG_EDITOR
 	void dump_debug_snapshots(const String& p_dir);
 
 	void space_dump_debug_snapshot(const RID& p_space, const String& p_dir);
 #endif // GDJ_CONFIG_EDITOR
 
+	Dictionary get_memory_report() const;
+
+	void dump_memory_report() const;
+
+	bool space_is_contact_stream_enabled(const RID& p_space) const;
+
+	void space_set_contact_stream_enabled(const RID& p_space, bool p_enabled);
+
+	Dictionary space_get_contact_stream(const RID& p_space) const;
+
+	bool space_is_deterministic(const RID& p_space) const;
+
+	void space_set_deterministic(const RID& p_space, bool p_enabled);
+
+	int64_t space_get_state_hash(const RID& p_space) const;
+
+	Dictionary space_get_interpolated_transforms(const RID& p_space, double p_fraction);
+
+	void space_shift_origin(const RID& p_space, const Vector3& p_offset);
+
+	int64_t space_add_projectiles(
+		const RID& p_space,
+		const PackedVector3Array& p_positions,
+		const PackedVector3Array& p_velocities,
+		float p_radius,
+		float p_gravity_scale,
+		float p_lifetime,
+		uint32_t p_collision_mask
+	);
+
+	void space_clear_projectiles(const RID& p_space);
+
+	Dictionary space_get_projectiles(const RID& p_space) const;
+
+	Dictionary space_get_projectile_hits(const RID& p_space) const;
+
+	PackedInt64Array space_intersect_aabb(
+		const RID& p_space,
+		const AABB& p_aabb,
+		uint32_t p_collision_mask,
+		bool p_collide_with_bodies,
+		bool p_collide_with_areas
+	) const;
+
+	PackedInt64Array space_intersect_sphere(
+		const RID& p_space,
+		const Vector3& p_center,
+		float p_radius,
+		uint32_t p_collision_mask,
+		bool p_collide_with_bodies,
+		bool p_collide_with_areas
+	) const;
+
+	int32_t space_get_max_pooled_bodies(const RID& p_space) const;
+
+	void space_set_max_pooled_bodies(const RID& p_space, int32_t p_count);
+
+	int32_t space_get_capacity(const RID& p_space, SpaceCapacityJolt p_capacity) const;
+
+	void space_set_capacity(const RID& p_space, SpaceCapacityJolt p_capacity, int32_t p_value);
+
+	PackedByteArray space_save_state(const RID& p_space, const PackedByteArray& p_base);
+
+	bool space_restore_state(
+		const RID& p_space,
+		const PackedByteArray& p_state,
+		const PackedByteArray& p_base
+	);
+
+	void area_set_batched_monitor_callback(const RID& p_area, const Callable& p_callback);
+
+	void area_set_batched_area_monitor_callback(const RID& p_area, const Callable& p_callback);
+
+	Vector3 space_get_soft_body_lod_reference(const RID& p_space) const;
+
+	void space_set_soft_body_lod_reference(const RID& p_space, const Vector3& p_position);
+
+	double space_get_soft_body_lod_param(const RID& p_space, SpaceSoftBodyLODParamJolt p_param)
+		const;
+
+	void space_set_soft_body_lod_param(
+		const RID& p_space,
+		SpaceSoftBodyLODParamJolt p_param,
+		double p_value
+	);
+
+	int32_t body_get_solver_velocity_iterations(const RID& p_body) const;
+
+	void body_set_solver_velocity_iterations(const RID& p_body, int32_t p_value);
+
+	int32_t body_get_solver_position_iterations(const RID& p_body) const;
+
+	void body_set_solver_position_iterations(const RID& p_body, int32_t p_value);
+
+	bool body_get_contact_impulse_estimation(const RID& p_body) const;
+
+	void body_set_contact_impulse_estimation(const RID& p_body, bool p_enabled);
+
+	RID ragdoll_create(const Dictionary& p_skeleton);
+
+	RID ragdoll_get_space(const RID& p_ragdoll) const;
+
+	void ragdoll_set_space(const RID& p_ragdoll, const RID& p_space);
+
+	void ragdoll_attach_object_instance_id(const RID& p_ragdoll, uint64_t p_id);
+
+	void ragdoll_set_collision_layer(const RID& p_ragdoll, uint32_t p_layer);
+
+	void ragdoll_set_collision_mask(const RID& p_ragdoll, uint32_t p_mask);
+
+	int32_t ragdoll_get_bone_count(const RID& p_ragdoll) const;
+
+	TypedArray<RID> ragdoll_get_bone_bodies(const RID& p_ragdoll) const;
+
+	bool ragdoll_is_kinematic(const RID& p_ragdoll) const;
+
+	void ragdoll_set_kinematic(const RID& p_ragdoll, bool p_enabled);
+
+	PackedFloat32Array ragdoll_get_pose(const RID& p_ragdoll) const;
+
+	void ragdoll_set_pose(const RID& p_ragdoll, const PackedFloat32Array& p_pose);
+
+	void ragdoll_drive_to_pose_using_kinematics(
+		const RID& p_ragdoll,
+		const PackedFloat32Array& p_pose
+	);
+
+	void ragdoll_drive_to_pose_using_motors(const RID& p_ragdoll, const PackedFloat32Array& p_pose);
+
+	void ragdoll_stop_motors(const RID& p_ragdoll);
+
+	RID vehicle_create(const RID& p_body, const Dictionary& p_settings);
+
+	RID vehicle_get_body(const RID& p_vehicle) const;
+
+	int32_t vehicle_get_wheel_count(const RID& p_vehicle) const;
+
+	void vehicle_set_driver_input(
+		const RID& p_vehicle,
+		float p_forward,
+		float p_right,
+		float p_brake,
+		float p_hand_brake
+	);
+
+	void vehicle_set_driver_inputs(
+		const TypedArray<RID>& p_vehicles,
+		const PackedFloat32Array& p_inputs
+	);
+
+	PackedFloat32Array vehicle_get_wheel_states(const RID& p_vehicle) const;
+
+	PackedFloat32Array vehicle_get_wheel_transforms(const RID& p_vehicle) const;
+
+	float vehicle_get_engine_rpm(const RID& p_vehicle) const;
+
+	int32_t vehicle_get_current_gear(const RID& p_vehicle) const;
+
 	bool joint_get_enabled(const RID& p_joint) const;
 
 	void joint_set_enabled(const RID& p_joint, bool p_enabled);
@@ -746,6 +940,10 @@ private:
 
 	mutable RID_PtrOwner<JoltJointImpl3D> joint_owner;
 
+	mutable RID_PtrOwner<JoltRagdollImpl3D> ragdoll_owner;
+
+	mutable RID_PtrOwner<JoltVehicleImpl3D> vehicle_owner;
+
 	HashSet<JoltSpace3D*> active_spaces;
 
 	JoltJobSystem* job_system = nullptr;
@@ -755,6 +953,8 @@ private:
 	bool flushing_queries = false;
 };
 
+VARIANT_ENUM_CAST(JoltPhysicsServer3DExtension::SpaceSoftBodyLODParamJolt)
+VARIANT_ENUM_CAST(JoltPhysicsServer3DExtension::SpaceCapacityJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3DExtension::HingeJointParamJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3DExtension::HingeJointFlagJolt)
 VARIANT_ENUM_CAST(JoltPhysicsServer3DExtension::SliderJointParamJolt)
@@ -1,6 +1,7 @@
 #include "jolt_shape_impl_3d.hpp"
 
 #include "objects/jolt_shaped_object_impl_3d.hpp"
+#include "servers/jolt_allocation_tracker.hpp"
 #include "shapes/jolt_custom_double_sided_shape.hpp"
 #include "shapes/jolt_custom_user_data_shape.hpp"
 
@@ -48,14 +49,25 @@ void JoltShapeImpl3D::set_solver_bias(float p_bias) {
 }
 
 JPH::ShapeRefC JoltShapeImpl3D::try_build() {
+	// Once built, the shape stays the same until destroyed, which only happens on the main thread,
+	// so we only need to lock when it might not have been built yet.
+	if (built.load(std::memory_order_acquire)) {
+		return jolt_ref;
+	}
+
+	const MutexLock build_lock(build_mutex);
+
 	if (jolt_ref == nullptr) {
+		const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_SHAPES);
 		jolt_ref = _build();
+		built.store(jolt_ref != nullptr, std::memory_order_release);
 	}
 
 	return jolt_ref;
 }
 
 void JoltShapeImpl3D::destroy() {
+	built.store(false, std::memory_order_relaxed);
 	jolt_ref = nullptr;
 
 	for (const auto& [owner, ref_count] : ref_counts_by_owner) {
@@ -3,6 +3,10 @@
 class JoltShapedObjectImpl3D;
 
 class JoltShapeImpl3D {
+	using Mutex = std::mutex;
+
+	using MutexLock = std::unique_lock<Mutex>;
+
 public:
 	using ShapeType = PhysicsServer3D::ShapeType;
 
@@ -84,6 +88,12 @@ protected:
 	RID rid;
 
 	JPH::ShapeRefC jolt_ref;
+
+private:
+	// Query shapes are built on first use, which can be from several querying threads at once
+	Mutex build_mutex;
+
+	std::atomic<bool> built = false;
 };
 
 #ifdef GDJ_CONFIG_EDITOR
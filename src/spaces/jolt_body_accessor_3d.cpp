@@ -58,6 +58,21 @@ void JoltBodyAccessor3D::acquire_all() {
 
 	space->get_physics_system().GetBodies(*vector);
 
+	if (space->has_pooled_bodies()) {
+		// Pooled bodies are still owned by the physics system, despite not belonging to any object,
+		// so we need to filter them out to not have them be mistaken for regular bodies.
+		vector->erase(
+			std::remove_if(
+				vector->begin(),
+				vector->end(),
+				[&](const JPH::BodyID& p_id) {
+					return space->is_body_pooled(p_id);
+				}
+			),
+			vector->end()
+		);
+	}
+
 	_acquire_internal(vector->data(), (int32_t)vector->size());
 }
 
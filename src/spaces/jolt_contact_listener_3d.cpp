@@ -6,6 +6,26 @@
 #include "servers/jolt_project_settings.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+namespace {
+
+bool shape_pair_less(const JPH::SubShapeIDPair& p_lhs, const JPH::SubShapeIDPair& p_rhs) {
+	if (p_lhs.GetBody1ID() != p_rhs.GetBody1ID()) {
+		return p_lhs.GetBody1ID() < p_rhs.GetBody1ID();
+	}
+
+	if (p_lhs.GetBody2ID() != p_rhs.GetBody2ID()) {
+		return p_lhs.GetBody2ID() < p_rhs.GetBody2ID();
+	}
+
+	if (p_lhs.GetSubShapeID1() != p_rhs.GetSubShapeID1()) {
+		return p_lhs.GetSubShapeID1().GetValue() < p_rhs.GetSubShapeID1().GetValue();
+	}
+
+	return p_lhs.GetSubShapeID2().GetValue() < p_rhs.GetSubShapeID2().GetValue();
+}
+
+} // namespace
+
 void JoltContactListener3D::listen_for(JoltShapedObjectImpl3D* p_object) {
 	listening_for.insert(p_object->get_jolt_id());
 }
@@ -19,12 +39,51 @@ void JoltContactListener3D::pre_step() {
 }
 
 void JoltContactListener3D::post_step() {
+	_flush_unconfirmed_overlaps();
+	_flush_contact_stream();
 	_flush_contacts();
 	_flush_area_shifts();
 	_flush_area_exits();
 	_flush_area_enters();
 }
 
+void JoltContactListener3D::physics_system_changed() {
+	// The new physics system starts out with an empty contact cache, meaning it will never report
+	// the removal of any contacts that existed before it was created. Manifolds are rebuilt from
+	// scratch every step anyway, but area overlaps are not, so we keep track of which ones haven't
+	// been seen since and treat those as having ended.
+	manifolds_by_shape_pair.clear();
+
+	_unconfirm_area_overlaps();
+}
+
+void JoltContactListener3D::state_restored() {
+	// The restored contact cache won't report the removal of any overlaps that began after the
+	// state was saved, so just like with a new physics system we treat any overlap that isn't seen
+	// again as having ended. Overlaps that only exist in the restored state get reported as usual.
+	_unconfirm_area_overlaps();
+}
+
+void JoltContactListener3D::set_contact_stream_enabled(bool p_enabled) {
+	contact_stream_enabled = p_enabled;
+
+	if (!contact_stream_enabled) {
+		contact_stream = ContactStream();
+	}
+}
+
+Dictionary JoltContactListener3D::get_contact_stream() const {
+	Dictionary result;
+	result["rids"] = contact_stream.rids;
+	result["collider_rids"] = contact_stream.collider_rids;
+	result["shapes"] = contact_stream.shapes;
+	result["collider_shapes"] = contact_stream.collider_shapes;
+	result["points"] = contact_stream.points;
+	result["normals"] = contact_stream.normals;
+	result["impulses"] = contact_stream.impulses;
+	return result;
+}
+
 void JoltContactListener3D::OnContactAdded(
 	const JPH::Body& p_body1,
 	const JPH::Body& p_body2,
@@ -203,10 +262,22 @@ bool JoltContactListener3D::_try_add_contacts(
 		return false;
 	}
 
-	if (!_is_listening_for(p_body1) && !_is_listening_for(p_body2)) {
+	const bool listening1 = _is_listening_for(p_body1);
+	const bool listening2 = _is_listening_for(p_body2);
+
+	if (!listening1 && !listening2) {
 		return false;
 	}
 
+	const auto* body1 = reinterpret_cast<const JoltBodyImpl3D*>(p_body1.GetUserData());
+	const auto* body2 = reinterpret_cast<const JoltBodyImpl3D*>(p_body2.GetUserData());
+
+	// Estimating the collision response is by far the most expensive part of this, so we let
+	// bodies that only care about where and what they hit opt out of it, in which case they'll get
+	// zero impulses and velocities for their contacts.
+	const bool estimate_response = (listening1 && body1->estimates_contact_impulses()) ||
+		(listening2 && body2->estimates_contact_impulses());
+
 	const JPH::SubShapeIDPair shape_pair(
 		p_body1.GetID(),
 		p_manifold.mSubShapeID1,
@@ -227,16 +298,18 @@ bool JoltContactListener3D::_try_add_contacts(
 
 	JPH::CollisionEstimationResult collision;
 
-	JPH::EstimateCollisionResponse(
-		p_body1,
-		p_body2,
-		p_manifold,
-		collision,
-		p_settings.mCombinedFriction,
-		p_settings.mCombinedRestitution,
-		JoltProjectSettings::get_bounce_velocity_threshold(),
-		5
-	);
+	if (estimate_response) {
+		JPH::EstimateCollisionResponse(
+			p_body1,
+			p_body2,
+			p_manifold,
+			collision,
+			p_settings.mCombinedFriction,
+			p_settings.mCombinedRestitution,
+			JoltProjectSettings::get_bounce_velocity_threshold(),
+			5
+		);
+	}
 
 	for (JPH::uint i = 0; i < contact_count; ++i) {
 		Contact& contact1 = manifold.contacts1.emplace_back();
@@ -248,6 +321,18 @@ bool JoltContactListener3D::_try_add_contacts(
 		const JPH::RVec3 world_point1 = p_manifold.mBaseOffset + relative_point1;
 		const JPH::RVec3 world_point2 = p_manifold.mBaseOffset + relative_point2;
 
+		contact1.normal = -p_manifold.mWorldSpaceNormal;
+		contact1.point_self = world_point1;
+		contact1.point_other = world_point2;
+
+		contact2.normal = p_manifold.mWorldSpaceNormal;
+		contact2.point_self = world_point2;
+		contact2.point_other = world_point1;
+
+		if (!estimate_response) {
+			continue;
+		}
+
 		const JPH::Vec3 velocity1 = p_body1.GetPointVelocity(world_point1);
 		const JPH::Vec3 velocity2 = p_body2.GetPointVelocity(world_point2);
 
@@ -258,16 +343,10 @@ bool JoltContactListener3D::_try_add_contacts(
 		const JPH::Vec3 friction_impulse2 = collision.mTangent2 * impulse.mFrictionImpulse2;
 		const JPH::Vec3 combined_impulse = contact_impulse + friction_impulse1 + friction_impulse2;
 
-		contact1.normal = -p_manifold.mWorldSpaceNormal;
-		contact1.point_self = world_point1;
-		contact1.point_other = world_point2;
 		contact1.velocity_self = velocity1;
 		contact1.velocity_other = velocity2;
 		contact1.impulse = -combined_impulse;
 
-		contact2.normal = p_manifold.mWorldSpaceNormal;
-		contact2.point_self = world_point2;
-		contact2.point_other = world_point1;
 		contact2.velocity_self = velocity2;
 		contact2.velocity_other = velocity1;
 		contact2.impulse = combined_impulse;
@@ -288,6 +367,8 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
 		const MutexLock write_lock(write_mutex);
 
+		unconfirmed_overlaps.erase(p_shape_pair);
+
 		if (p_area.can_monitor(p_object)) {
 			if (!area_overlaps.has(p_shape_pair)) {
 				area_overlaps.insert(p_shape_pair);
@@ -472,8 +553,54 @@ bool JoltContactListener3D::_try_add_debug_contacts(
 
 #endif // GDJ_CONFIG_EDITOR
 
+template<typename TCallable>
+void JoltContactListener3D::_for_each_manifold(TCallable&& p_callable) {
+	if (!deterministic) {
+		for (auto&& [shape_pair, manifold] : manifolds_by_shape_pair) {
+			p_callable(shape_pair, manifold);
+		}
+
+		return;
+	}
+
+	sorted_shape_pairs.clear();
+
+	for (const auto& [shape_pair, manifold] : manifolds_by_shape_pair) {
+		sorted_shape_pairs.push_back(shape_pair);
+	}
+
+	sorted_shape_pairs.sort(shape_pair_less);
+
+	for (const JPH::SubShapeIDPair& shape_pair : sorted_shape_pairs) {
+		p_callable(shape_pair, manifolds_by_shape_pair.get(shape_pair));
+	}
+}
+
+template<typename TCallable>
+void JoltContactListener3D::_for_each_shape_pair(const Overlaps& p_pairs, TCallable&& p_callable) {
+	if (!deterministic) {
+		for (const JPH::SubShapeIDPair& shape_pair : p_pairs) {
+			p_callable(shape_pair);
+		}
+
+		return;
+	}
+
+	sorted_shape_pairs.clear();
+
+	for (const JPH::SubShapeIDPair& shape_pair : p_pairs) {
+		sorted_shape_pairs.push_back(shape_pair);
+	}
+
+	sorted_shape_pairs.sort(shape_pair_less);
+
+	for (const JPH::SubShapeIDPair& shape_pair : sorted_shape_pairs) {
+		p_callable(shape_pair);
+	}
+}
+
 void JoltContactListener3D::_flush_contacts() {
-	for (auto&& [shape_pair, manifold] : manifolds_by_shape_pair) {
+	_for_each_manifold([&](const JPH::SubShapeIDPair& shape_pair, Manifold& manifold) {
 		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
 
 		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
@@ -519,11 +646,79 @@ void JoltContactListener3D::_flush_contacts() {
 
 		manifold.contacts1.clear();
 		manifold.contacts2.clear();
+	});
+}
+
+void JoltContactListener3D::_flush_contact_stream() {
+	if (!contact_stream_enabled) {
+		return;
+	}
+
+	int32_t contact_count = 0;
+
+	for (const auto& [shape_pair, manifold] : manifolds_by_shape_pair) {
+		contact_count += (int32_t)manifold.contacts1.size();
+		contact_count += (int32_t)manifold.contacts2.size();
+	}
+
+	// The arrays handed out by `get_contact_stream` share their data with ours, so rather than
+	// writing into them we start over with fresh ones, leaving any previous stream untouched.
+	contact_stream = ContactStream();
+	contact_stream.resize(contact_count);
+
+	int32_t* shapes = contact_stream.shapes.ptrw();
+	int32_t* collider_shapes = contact_stream.collider_shapes.ptrw();
+	Vector3* points = contact_stream.points.ptrw();
+	Vector3* normals = contact_stream.normals.ptrw();
+	Vector3* impulses = contact_stream.impulses.ptrw();
+
+	int32_t index = 0;
+
+	_for_each_manifold([&](const JPH::SubShapeIDPair& shape_pair, const Manifold& manifold) {
+		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
+
+		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
+
+		const JoltBodyImpl3D* body1 = jolt_bodies[0].as_body();
+		ERR_FAIL_NULL(body1);
+
+		const JoltBodyImpl3D* body2 = jolt_bodies[1].as_body();
+		ERR_FAIL_NULL(body2);
+
+		const int32_t shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
+		const int32_t shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
+
+		auto write_contacts = [&](const Contacts& p_contacts,
+								  const JoltBodyImpl3D& p_body,
+								  const JoltBodyImpl3D& p_collider,
+								  int32_t p_shape_index,
+								  int32_t p_collider_shape_index) {
+			for (const Contact& contact : p_contacts) {
+				contact_stream.rids[index] = p_body.get_rid();
+				contact_stream.collider_rids[index] = p_collider.get_rid();
+				shapes[index] = p_shape_index;
+				collider_shapes[index] = p_collider_shape_index;
+				points[index] = to_godot(contact.point_self);
+				normals[index] = to_godot(contact.normal);
+				impulses[index] = to_godot(contact.impulse);
+
+				index += 1;
+			}
+		};
+
+		write_contacts(manifold.contacts1, *body1, *body2, shape_index1, shape_index2);
+		write_contacts(manifold.contacts2, *body2, *body1, shape_index2, shape_index1);
+	});
+
+	// We might have skipped some invalid bodies above, in which case only the first `index` entries
+	// were written to, so we trim off the rest rather than leave them default-initialized.
+	if (index != contact_count) {
+		contact_stream.resize(index);
 	}
 }
 
 void JoltContactListener3D::_flush_area_enters() {
-	for (const JPH::SubShapeIDPair& shape_pair : area_enters) {
+	_for_each_shape_pair(area_enters, [&](const JPH::SubShapeIDPair& shape_pair) {
 		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
 		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
 
@@ -538,7 +733,7 @@ void JoltContactListener3D::_flush_area_enters() {
 		const JoltReadableBody3D jolt_body2 = jolt_bodies[1];
 
 		if (jolt_body1.is_invalid() || jolt_body2.is_invalid()) {
-			continue;
+			return;
 		}
 
 		JoltAreaImpl3D* area1 = jolt_body1.as_area();
@@ -551,7 +746,7 @@ void JoltContactListener3D::_flush_area_enters() {
 		} else if (area1 == nullptr && area2 != nullptr) {
 			area2->body_shape_entered(body_id1, sub_shape_id1, sub_shape_id2);
 		}
-	}
+	});
 
 	area_enters.clear();
 }
@@ -586,7 +781,7 @@ void JoltContactListener3D::_flush_area_shifts() {
 }
 
 void JoltContactListener3D::_flush_area_exits() {
-	for (const JPH::SubShapeIDPair& shape_pair : area_exits) {
+	_for_each_shape_pair(area_exits, [&](const JPH::SubShapeIDPair& shape_pair) {
 		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
 		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
 
@@ -617,7 +812,50 @@ void JoltContactListener3D::_flush_area_exits() {
 		} else if (area2 != nullptr) {
 			area2->shape_exited(body_id1, sub_shape_id1, sub_shape_id2);
 		}
-	}
+	});
 
 	area_exits.clear();
 }
+
+void JoltContactListener3D::_flush_unconfirmed_overlaps() {
+	if (unconfirmed_overlaps.is_empty()) {
+		return;
+	}
+
+	LocalVector<JPH::SubShapeIDPair> resolved_overlaps;
+
+	for (const JPH::SubShapeIDPair& shape_pair : unconfirmed_overlaps) {
+		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
+
+		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
+
+		const JoltReadableBody3D jolt_body1 = jolt_bodies[0];
+		const JoltReadableBody3D jolt_body2 = jolt_bodies[1];
+
+		if (jolt_body1.is_invalid() || jolt_body2.is_invalid()) {
+			// The overlap will have been dealt with when the body was removed
+			resolved_overlaps.push_back(shape_pair);
+			continue;
+		}
+
+		// Jolt won't have reported anything for a pair where both bodies are asleep, so we have no
+		// way of knowing whether the overlap still exists until one of them wakes up.
+		if (jolt_body1->IsActive() || jolt_body2->IsActive()) {
+			resolved_overlaps.push_back(shape_pair);
+
+			if (area_overlaps.erase(shape_pair)) {
+				area_exits.insert(shape_pair);
+			}
+		}
+	}
+
+	for (const JPH::SubShapeIDPair& shape_pair : resolved_overlaps) {
+		unconfirmed_overlaps.erase(shape_pair);
+	}
+}
+
+void JoltContactListener3D::_unconfirm_area_overlaps() {
+	for (const JPH::SubShapeIDPair& shape_pair : area_overlaps) {
+		unconfirmed_overlaps.insert(shape_pair);
+	}
+}
@@ -56,6 +56,32 @@ class JoltContactListener3D final
 
 	using ManifoldsByShapePair = HashMap<JPH::SubShapeIDPair, Manifold, ShapePairHasher>;
 
+	struct ContactStream {
+		void resize(int32_t p_count) {
+			rids.resize(p_count);
+			collider_rids.resize(p_count);
+			shapes.resize(p_count);
+			collider_shapes.resize(p_count);
+			points.resize(p_count);
+			normals.resize(p_count);
+			impulses.resize(p_count);
+		}
+
+		TypedArray<RID> rids;
+
+		TypedArray<RID> collider_rids;
+
+		PackedInt32Array shapes;
+
+		PackedInt32Array collider_shapes;
+
+		PackedVector3Array points;
+
+		PackedVector3Array normals;
+
+		PackedVector3Array impulses;
+	};
+
 public:
 	explicit JoltContactListener3D(JoltSpace3D* p_space)
 		: space(p_space) { }
@@ -66,6 +92,20 @@ public:
 
 	void post_step();
 
+	void physics_system_changed();
+
+	void state_restored();
+
+	bool is_contact_stream_enabled() const { return contact_stream_enabled; }
+
+	void set_contact_stream_enabled(bool p_enabled);
+
+	Dictionary get_contact_stream() const;
+
+	bool is_deterministic() const { return deterministic; }
+
+	void set_deterministic(bool p_enabled) { deterministic = p_enabled; }
+
 #ifdef GDJ_CONFIG_EDITOR
 	const PackedVector3Array& get_debug_contacts() const { return debug_contacts; }
 
@@ -158,14 +198,26 @@ private:
 	);
 #endif // GDJ_CONFIG_EDITOR
 
+	template<typename TCallable>
+	void _for_each_manifold(TCallable&& p_callable);
+
+	template<typename TCallable>
+	void _for_each_shape_pair(const Overlaps& p_pairs, TCallable&& p_callable);
+
 	void _flush_contacts();
 
+	void _flush_contact_stream();
+
 	void _flush_area_enters();
 
 	void _flush_area_shifts();
 
 	void _flush_area_exits();
 
+	void _flush_unconfirmed_overlaps();
+
+	void _unconfirm_area_overlaps();
+
 	ManifoldsByShapePair manifolds_by_shape_pair;
 
 	BodyIDs listening_for;
@@ -176,10 +228,20 @@ private:
 
 	Overlaps area_exits;
 
+	Overlaps unconfirmed_overlaps;
+
+	ContactStream contact_stream;
+
+	LocalVector<JPH::SubShapeIDPair> sorted_shape_pairs;
+
 	Mutex write_mutex;
 
 	JoltSpace3D* space = nullptr;
 
+	bool contact_stream_enabled = false;
+
+	bool deterministic = false;
+
 #ifdef GDJ_CONFIG_EDITOR
 	PackedVector3Array debug_contacts;
 
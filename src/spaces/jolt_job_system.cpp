@@ -60,6 +60,9 @@ JoltJobSystem::Job::Job(
 #ifdef GDJ_CONFIG_EDITOR
 	, name(p_name)
 #endif // GDJ_CONFIG_EDITOR
+#ifdef GDJ_TRACK_ALLOCATIONS
+	, allocation_tag(JoltAllocationTracker::get_current_tag())
+#endif // GDJ_TRACK_ALLOCATIONS
 {
 }
 
@@ -116,6 +119,12 @@ void JoltJobSystem::Job::queue() {
 void JoltJobSystem::Job::_execute(void* p_user_data) {
 	auto* job = static_cast<Job*>(p_user_data);
 
+#ifdef GDJ_TRACK_ALLOCATIONS
+	// Jobs are executed on worker threads, so we carry over whatever tag was active on the thread
+	// that created them, to make sure their allocations end up in the right category
+	const JoltAllocationScope allocation_scope(job->allocation_tag);
+#endif // GDJ_TRACK_ALLOCATIONS
+
 #ifdef GDJ_CONFIG_EDITOR
 	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
 #endif // GDJ_CONFIG_EDITOR
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "servers/jolt_allocation_tracker.hpp"
+
 class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 public:
 	JoltJobSystem();
@@ -46,6 +48,10 @@ private:
 		const char* name = nullptr;
 #endif // GDJ_CONFIG_EDITOR
 
+#ifdef GDJ_TRACK_ALLOCATIONS
+		JoltAllocationTag allocation_tag = JOLT_ALLOCATION_TAG_UNTAGGED;
+#endif // GDJ_TRACK_ALLOCATIONS
+
 		int64_t task_id = -1;
 
 		std::atomic<Job*> completed_next = nullptr;
@@ -12,6 +12,47 @@
 #include "spaces/jolt_query_filter_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+namespace {
+
+using JoltBroadPhaseCollector = JoltQueryCollectorAll<JPH::CollideShapeBodyCollector, 64>;
+
+PackedInt64Array broad_phase_hits_to_array(
+	const JoltSpace3D& p_space,
+	const JoltBroadPhaseCollector& p_collector,
+	const JoltQueryFilter3D& p_query_filter
+) {
+	const int32_t hit_count = p_collector.get_hit_count();
+
+	PackedInt64Array result;
+	result.resize((int64_t)hit_count * 2);
+
+	int64_t* data = result.ptrw();
+	int32_t result_count = 0;
+
+	for (int32_t i = 0; i < hit_count; ++i) {
+		const JoltReadableBody3D body = p_space.read_body(p_collector.get_hit(i));
+
+		// The broad-phase doesn't apply any body filter, so we need to do that ourselves
+		if (body.is_invalid() || !p_query_filter.ShouldCollideLocked(*body)) {
+			continue;
+		}
+
+		const JoltObjectImpl3D* object = body.as_object();
+		ERR_CONTINUE(object == nullptr);
+
+		*data++ = (int64_t)object->get_rid().get_id();
+		*data++ = (int64_t)object->get_instance_id();
+
+		result_count++;
+	}
+
+	result.resize((int64_t)result_count * 2);
+
+	return result;
+}
+
+} // namespace
+
 JoltPhysicsDirectSpaceState3DExtension::JoltPhysicsDirectSpaceState3DExtension(JoltSpace3D* p_space)
 	: space(p_space) { }
 
@@ -26,7 +67,7 @@ bool JoltPhysicsDirectSpaceState3DExtension::_intersect_ray(
 	bool p_pick_ray,
 	PhysicsServer3DExtensionRayResult* p_result
 ) {
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
 	const JoltQueryFilter3D query_filter(
 		*this,
@@ -113,7 +154,7 @@ int32_t JoltPhysicsDirectSpaceState3DExtension::_intersect_point(
 		return 0;
 	}
 
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
 	const JoltQueryFilter3D
 		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
@@ -164,9 +205,11 @@ int32_t JoltPhysicsDirectSpaceState3DExtension::_intersect_shape(
 		return 0;
 	}
 
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
-	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape(p_shape_rid);
+	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape_for_query(
+		p_shape_rid
+	);
 	ERR_FAIL_NULL_D(shape);
 
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
@@ -249,9 +292,11 @@ bool JoltPhysicsDirectSpaceState3DExtension::_cast_motion(
 		"Providing rest info as part of a shape-cast is not supported by Godot Jolt."
 	);
 
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
-	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape(p_shape_rid);
+	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape_for_query(
+		p_shape_rid
+	);
 	ERR_FAIL_NULL_D(shape);
 
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
@@ -319,9 +364,11 @@ bool JoltPhysicsDirectSpaceState3DExtension::_collide_shape(
 		return false;
 	}
 
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
-	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape(p_shape_rid);
+	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape_for_query(
+		p_shape_rid
+	);
 	ERR_FAIL_NULL_D(shape);
 
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
@@ -420,9 +467,11 @@ bool JoltPhysicsDirectSpaceState3DExtension::_rest_info(
 	bool p_collide_with_areas,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
-	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape(p_shape_rid);
+	JoltShapeImpl3D* shape = JoltPhysicsServer3DExtension::get_singleton()->get_shape_for_query(
+		p_shape_rid
+	);
 	ERR_FAIL_NULL_D(shape);
 
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
@@ -501,13 +550,13 @@ Vector3 JoltPhysicsDirectSpaceState3DExtension::_get_closest_point_to_object_vol
 	const RID& p_object,
 	const Vector3& p_point
 ) const {
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
 	JoltPhysicsServer3DExtension* physics_server = JoltPhysicsServer3DExtension::get_singleton();
-	JoltObjectImpl3D* object = physics_server->get_area(p_object);
+	JoltObjectImpl3D* object = physics_server->get_area_for_query(p_object);
 
 	if (object == nullptr) {
-		object = physics_server->get_body(p_object);
+		object = physics_server->get_body_for_query(p_object);
 	}
 
 	ERR_FAIL_NULL_D(object);
@@ -593,6 +642,45 @@ Vector3 JoltPhysicsDirectSpaceState3DExtension::_get_closest_point_to_object_vol
 	}
 }
 
+PackedInt64Array JoltPhysicsDirectSpaceState3DExtension::intersect_aabb(
+	const AABB& p_aabb,
+	uint32_t p_collision_mask,
+	bool p_collide_with_bodies,
+	bool p_collide_with_areas
+) const {
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
+
+	const JoltQueryFilter3D
+		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+
+	JoltBroadPhaseCollector collector;
+
+	space->get_broad_phase_query()
+		.CollideAABox(to_jolt(p_aabb), collector, query_filter, query_filter);
+
+	return broad_phase_hits_to_array(*space, collector, query_filter);
+}
+
+PackedInt64Array JoltPhysicsDirectSpaceState3DExtension::intersect_sphere(
+	const Vector3& p_center,
+	float p_radius,
+	uint32_t p_collision_mask,
+	bool p_collide_with_bodies,
+	bool p_collide_with_areas
+) const {
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
+
+	const JoltQueryFilter3D
+		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+
+	JoltBroadPhaseCollector collector;
+
+	space->get_broad_phase_query()
+		.CollideSphere(to_jolt(p_center), p_radius, collector, query_filter, query_filter);
+
+	return broad_phase_hits_to_array(*space, collector, query_filter);
+}
+
 bool JoltPhysicsDirectSpaceState3DExtension::test_body_motion(
 	const JoltBodyImpl3D& p_body,
 	const Transform3D& p_transform,
@@ -619,7 +707,7 @@ bool JoltPhysicsDirectSpaceState3DExtension::test_body_motion(
 	Vector3 scale;
 	Math::decompose(transform, scale);
 
-	space->try_optimize();
+	const JoltSpace3D::QueryLock query_lock = space->lock_for_query();
 
 	Vector3 recovery;
 	const bool recovered = _body_motion_recover(p_body, transform, p_margin, recovery);
@@ -88,6 +88,21 @@ public:
 	Vector3 _get_closest_point_to_object_volume(const RID& p_object, const Vector3& p_point)
 		const override;
 
+	PackedInt64Array intersect_aabb(
+		const AABB& p_aabb,
+		uint32_t p_collision_mask,
+		bool p_collide_with_bodies,
+		bool p_collide_with_areas
+	) const;
+
+	PackedInt64Array intersect_sphere(
+		const Vector3& p_center,
+		float p_radius,
+		uint32_t p_collision_mask,
+		bool p_collide_with_bodies,
+		bool p_collide_with_areas
+	) const;
+
 	bool test_body_motion(
 		const JoltBodyImpl3D& p_body,
 		const Transform3D& p_transform,
@@ -0,0 +1,339 @@
+#include "jolt_projectile_system_3d.hpp"
+
+#include "objects/jolt_object_impl_3d.hpp"
+#include "objects/jolt_shaped_object_impl_3d.hpp"
+#include "spaces/jolt_broad_phase_layer.hpp"
+#include "spaces/jolt_query_collectors.hpp"
+#include "spaces/jolt_space_3d.hpp"
+
+namespace {
+
+// Projectiles are advanced in batches of this size, with each batch being its own job, which keeps
+// the overhead of the jobs themselves small relative to the casts they perform.
+constexpr int32_t BATCH_SIZE = 256;
+
+class JoltProjectileFilter3D final
+	: public JPH::BroadPhaseLayerFilter
+	, public JPH::ObjectLayerFilter {
+public:
+	JoltProjectileFilter3D(const JoltSpace3D& p_space, uint32_t p_collision_mask)
+		: space(p_space)
+		, collision_mask(p_collision_mask) { }
+
+	bool ShouldCollide(JPH::BroadPhaseLayer p_broad_phase_layer) const override {
+		return p_broad_phase_layer == JoltBroadPhaseLayer::BODY_STATIC ||
+			p_broad_phase_layer == JoltBroadPhaseLayer::BODY_STATIC_BIG ||
+			p_broad_phase_layer == JoltBroadPhaseLayer::BODY_DYNAMIC;
+	}
+
+	bool ShouldCollide(JPH::ObjectLayer p_object_layer) const override {
+		JPH::BroadPhaseLayer object_broad_phase_layer = {};
+		uint32_t object_collision_layer = 0;
+		uint32_t object_collision_mask = 0;
+
+		space.map_from_object_layer(
+			p_object_layer,
+			object_broad_phase_layer,
+			object_collision_layer,
+			object_collision_mask
+		);
+
+		return (collision_mask & object_collision_layer) != 0;
+	}
+
+private:
+	const JoltSpace3D& space;
+
+	uint32_t collision_mask = 0;
+};
+
+} // namespace
+
+int64_t JoltProjectileSystem3D::add(
+	const PackedVector3Array& p_positions,
+	const PackedVector3Array& p_velocities,
+	float p_radius,
+	float p_gravity_scale,
+	float p_lifetime,
+	uint32_t p_collision_mask
+) {
+	ERR_FAIL_COND_V_MSG(
+		p_positions.size() != p_velocities.size(),
+		-1,
+		vformat(
+			"Failed to add projectiles. Expected %d velocities, but %d were provided.",
+			p_positions.size(),
+			p_velocities.size()
+		)
+	);
+
+	const auto count = (int32_t)p_positions.size();
+	const int32_t offset = projectiles.size();
+	const int64_t first_id = next_id;
+
+	projectiles.resize(offset + count);
+
+	const Vector3* positions = p_positions.ptr();
+	const Vector3* velocities = p_velocities.ptr();
+
+	for (int32_t i = 0; i < count; ++i) {
+		Projectile& projectile = projectiles[offset + i];
+		projectile.position = to_jolt_r(positions[i]);
+		projectile.velocity = to_jolt(velocities[i]);
+		projectile.id = next_id++;
+		projectile.radius = MAX(p_radius, 0.0f);
+		projectile.gravity_scale = p_gravity_scale;
+		projectile.lifetime = MAX(p_lifetime, 0.0f);
+		projectile.collision_mask = p_collision_mask;
+	}
+
+	return first_id;
+}
+
+void JoltProjectileSystem3D::clear() {
+	projectiles.clear();
+	results.clear();
+	hit_stream = HitStream();
+}
+
+Dictionary JoltProjectileSystem3D::get_projectiles() const {
+	const int32_t projectile_count = projectiles.size();
+
+	PackedInt64Array ids;
+	PackedVector3Array positions;
+	PackedVector3Array velocities;
+
+	ids.resize(projectile_count);
+	positions.resize(projectile_count);
+	velocities.resize(projectile_count);
+
+	int64_t* ids_ptr = ids.ptrw();
+	Vector3* positions_ptr = positions.ptrw();
+	Vector3* velocities_ptr = velocities.ptrw();
+
+	for (int32_t i = 0; i < projectile_count; ++i) {
+		const Projectile& projectile = projectiles[i];
+		ids_ptr[i] = projectile.id;
+		positions_ptr[i] = to_godot(projectile.position);
+		velocities_ptr[i] = to_godot(projectile.velocity);
+	}
+
+	Dictionary result;
+	result["ids"] = ids;
+	result["positions"] = positions;
+	result["velocities"] = velocities;
+	return result;
+}
+
+Dictionary JoltProjectileSystem3D::get_hits() const {
+	Dictionary result;
+	result["ids"] = hit_stream.ids;
+	result["rids"] = hit_stream.rids;
+	result["shapes"] = hit_stream.shapes;
+	result["points"] = hit_stream.points;
+	result["normals"] = hit_stream.normals;
+	result["velocities"] = hit_stream.velocities;
+	return result;
+}
+
+void JoltProjectileSystem3D::step(float p_step, JPH::JobSystem& p_job_system) {
+	const int32_t projectile_count = projectiles.size();
+
+	// Projectiles only ever see the space's default gravity, since sampling the gravity overrides of
+	// every area that a projectile passes through would cost more than the projectile itself.
+	const JPH::Vec3 gravity = space->get_physics_system().GetGravity();
+
+	results.resize(projectile_count);
+
+	const int32_t batch_count = (projectile_count + BATCH_SIZE - 1) / BATCH_SIZE;
+
+	if (batch_count <= 1) {
+		_advance(0, projectile_count, p_step, gravity);
+	} else {
+		JPH::JobSystem::Barrier* barrier = p_job_system.CreateBarrier();
+
+		for (int32_t i = 0; i < batch_count; ++i) {
+			const int32_t begin = i * BATCH_SIZE;
+			const int32_t end = MIN(begin + BATCH_SIZE, projectile_count);
+
+			const JPH::JobHandle job = p_job_system.CreateJob(
+				"Projectiles",
+				JPH::Color::sCyan,
+				[this, begin, end, p_step, &gravity]() {
+					_advance(begin, end, p_step, gravity);
+				}
+			);
+
+			barrier->AddJob(job);
+		}
+
+		p_job_system.WaitForJobs(barrier);
+		p_job_system.DestroyBarrier(barrier);
+	}
+
+	_flush_hits();
+}
+
+void JoltProjectileSystem3D::shift_origin(const JPH::RVec3& p_offset) {
+	for (Projectile& projectile : projectiles) {
+		projectile.position += p_offset;
+	}
+}
+
+void JoltProjectileSystem3D::_advance(
+	int32_t p_begin,
+	int32_t p_end,
+	float p_step,
+	JPH::Vec3Arg p_gravity
+) {
+	// This runs on multiple threads at once, which is fine since nothing modifies the physics
+	// system while projectiles are being advanced, but it does mean we can't report errors here.
+
+	const JPH::NarrowPhaseQuery& query = space->get_narrow_phase_query();
+
+	for (int32_t i = p_begin; i < p_end; ++i) {
+		Projectile& projectile = projectiles[i];
+		Result& result = results[i];
+
+		result = Result();
+
+		projectile.velocity += p_gravity * projectile.gravity_scale * p_step;
+
+		const JPH::Vec3 displacement = projectile.velocity * p_step;
+
+		const JoltProjectileFilter3D query_filter(*space, projectile.collision_mask);
+
+		if (projectile.radius > 0.0f) {
+			JPH::SphereShape sphere(projectile.radius);
+			sphere.SetEmbedded();
+
+			const JPH::RShapeCast shape_cast(
+				&sphere,
+				JPH::Vec3::sReplicate(1.0f),
+				JPH::RMat44::sTranslation(projectile.position),
+				displacement
+			);
+
+			JoltQueryCollectorClosest<JPH::CastShapeCollector> collector;
+
+			query.CastShape(
+				shape_cast,
+				JPH::ShapeCastSettings(),
+				projectile.position,
+				collector,
+				query_filter,
+				query_filter
+			);
+
+			if (collector.had_hit()) {
+				const JPH::ShapeCastResult& hit = collector.get_hit();
+
+				result.body_id = hit.mBodyID2;
+				result.sub_shape_id = hit.mSubShapeID2;
+				result.point = projectile.position + hit.mContactPointOn2;
+				result.normal = -hit.mPenetrationAxis.Normalized();
+			}
+		} else {
+			const JPH::RRayCast ray(projectile.position, displacement);
+
+			JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
+
+			query.CastRay(ray, JPH::RayCastSettings(), collector, query_filter, query_filter);
+
+			if (collector.had_hit()) {
+				const JPH::RayCastResult& hit = collector.get_hit();
+
+				result.body_id = hit.mBodyID;
+				result.sub_shape_id = hit.mSubShapeID2;
+				result.point = ray.GetPointOnRay(hit.mFraction);
+
+				const JoltReadableBody3D body = space->read_body(hit.mBodyID);
+
+				if (body.is_valid()) {
+					result.normal =
+						body->GetWorldSpaceSurfaceNormal(hit.mSubShapeID2, result.point);
+
+					// HACK(mihe): If we got a back-face normal we need to flip it
+					if (result.normal.Dot(displacement) > 0) {
+						result.normal = -result.normal;
+					}
+				}
+			}
+		}
+
+		if (!result.body_id.IsInvalid()) {
+			continue;
+		}
+
+		projectile.position += displacement;
+
+		if (projectile.lifetime > 0.0f) {
+			projectile.lifetime -= p_step;
+			result.expired = projectile.lifetime <= 0.0f;
+		}
+	}
+}
+
+void JoltProjectileSystem3D::_flush_hits() {
+	const int32_t projectile_count = projectiles.size();
+
+	int32_t hit_count = 0;
+
+	for (const Result& result : results) {
+		if (!result.body_id.IsInvalid()) {
+			hit_count += 1;
+		}
+	}
+
+	// The arrays handed out by `get_hits` share their data with ours, so rather than writing into
+	// them we start over with fresh ones, leaving any previous hits untouched.
+	hit_stream = HitStream();
+	hit_stream.resize(hit_count);
+
+	int64_t* ids = hit_stream.ids.ptrw();
+	int32_t* shapes = hit_stream.shapes.ptrw();
+	Vector3* points = hit_stream.points.ptrw();
+	Vector3* normals = hit_stream.normals.ptrw();
+	Vector3* velocities = hit_stream.velocities.ptrw();
+
+	int32_t hit_index = 0;
+	int32_t remaining_count = 0;
+
+	for (int32_t i = 0; i < projectile_count; ++i) {
+		const Projectile& projectile = projectiles[i];
+		const Result& result = results[i];
+
+		if (result.body_id.IsInvalid()) {
+			if (!result.expired) {
+				projectiles[remaining_count++] = projectile;
+			}
+
+			continue;
+		}
+
+		const JoltReadableBody3D body = space->read_body(result.body_id);
+		const JoltObjectImpl3D* object = body.as_object();
+
+		RID rid;
+		int32_t shape_index = 0;
+
+		if (object != nullptr) {
+			rid = object->get_rid();
+
+			if (const JoltShapedObjectImpl3D* shaped_object = object->as_shaped()) {
+				shape_index = MAX(shaped_object->find_shape_index(result.sub_shape_id), 0);
+			}
+		}
+
+		ids[hit_index] = projectile.id;
+		hit_stream.rids[hit_index] = rid;
+		shapes[hit_index] = shape_index;
+		points[hit_index] = to_godot(result.point);
+		normals[hit_index] = to_godot(result.normal);
+		velocities[hit_index] = to_godot(projectile.velocity);
+
+		hit_index += 1;
+	}
+
+	projectiles.resize(remaining_count);
+}
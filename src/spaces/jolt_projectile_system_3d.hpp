@@ -0,0 +1,96 @@
+#pragma once
+
+class JoltSpace3D;
+
+class JoltProjectileSystem3D {
+	struct Projectile {
+		JPH::RVec3 position = {};
+
+		JPH::Vec3 velocity = {};
+
+		int64_t id = 0;
+
+		float radius = 0.0f;
+
+		float gravity_scale = 0.0f;
+
+		float lifetime = 0.0f;
+
+		uint32_t collision_mask = 0;
+	};
+
+	struct Result {
+		JPH::RVec3 point = {};
+
+		JPH::Vec3 normal = {};
+
+		JPH::BodyID body_id;
+
+		JPH::SubShapeID sub_shape_id;
+
+		bool expired = false;
+	};
+
+	struct HitStream {
+		void resize(int32_t p_count) {
+			ids.resize(p_count);
+			rids.resize(p_count);
+			shapes.resize(p_count);
+			points.resize(p_count);
+			normals.resize(p_count);
+			velocities.resize(p_count);
+		}
+
+		PackedInt64Array ids;
+
+		TypedArray<RID> rids;
+
+		PackedInt32Array shapes;
+
+		PackedVector3Array points;
+
+		PackedVector3Array normals;
+
+		PackedVector3Array velocities;
+	};
+
+public:
+	explicit JoltProjectileSystem3D(JoltSpace3D* p_space)
+		: space(p_space) { }
+
+	bool is_empty() const { return projectiles.is_empty() && hit_stream.ids.is_empty(); }
+
+	int64_t add(
+		const PackedVector3Array& p_positions,
+		const PackedVector3Array& p_velocities,
+		float p_radius,
+		float p_gravity_scale,
+		float p_lifetime,
+		uint32_t p_collision_mask
+	);
+
+	void clear();
+
+	Dictionary get_projectiles() const;
+
+	Dictionary get_hits() const;
+
+	void step(float p_step, JPH::JobSystem& p_job_system);
+
+	void shift_origin(const JPH::RVec3& p_offset);
+
+private:
+	void _advance(int32_t p_begin, int32_t p_end, float p_step, JPH::Vec3Arg p_gravity);
+
+	void _flush_hits();
+
+	LocalVector<Projectile> projectiles;
+
+	LocalVector<Result> results;
+
+	HitStream hit_stream;
+
+	JoltSpace3D* space = nullptr;
+
+	int64_t next_id = 0;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+enum JoltSpaceSoftBodyLODParam {
+	SPACE_SOFT_BODY_LOD_REDUCE_DISTANCE,
+	SPACE_SOFT_BODY_LOD_SKIP_DISTANCE,
+	SPACE_SOFT_BODY_LOD_FREEZE_DISTANCE,
+	SPACE_SOFT_BODY_LOD_PRECISION,
+	SPACE_SOFT_BODY_LOD_SKIP_INTERVAL
+};
+
+enum JoltSoftBodyLOD : int8_t {
+	JOLT_SOFT_BODY_LOD_FULL,
+	JOLT_SOFT_BODY_LOD_REDUCED,
+	JOLT_SOFT_BODY_LOD_SKIPPED,
+	JOLT_SOFT_BODY_LOD_FROZEN
+};
@@ -3,43 +3,105 @@
 #include "joints/jolt_joint_impl_3d.hpp"
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
+#include "servers/jolt_allocation_tracker.hpp"
 #include "servers/jolt_physics_server_3d.hpp"
 #include "servers/jolt_project_settings.hpp"
 #include "shapes/jolt_custom_shape_type.hpp"
 #include "shapes/jolt_shape_impl_3d.hpp"
+#include "spaces/jolt_broad_phase_layer.hpp"
 #include "spaces/jolt_contact_listener_3d.hpp"
 #include "spaces/jolt_layer_mapper.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
+#include "spaces/jolt_projectile_system_3d.hpp"
+#include "spaces/jolt_state_recorder.hpp"
 #include "spaces/jolt_temp_allocator.hpp"
 
 namespace {
 
-constexpr double DEFAULT_CONTACT_RECYCLE_RADIUS = 0.01;
-constexpr double DEFAULT_CONTACT_MAX_SEPARATION = 0.05;
-constexpr double DEFAULT_CONTACT_MAX_ALLOWED_PENETRATION = 0.01;
-constexpr double DEFAULT_CONTACT_DEFAULT_BIAS = 0.8;
-constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
-constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
+
+// Bodies are shifted in batches of this size, with each batch being its own job
+constexpr int32_t ORIGIN_SHIFT_BATCH_SIZE = 256;
+
+constexpr int32_t MIN_CAPACITY = 8;
+
+// Jolt can't address any more bodies than this, and we hold the other capacities to the same limit
+// when growing them, so as to not have a runaway simulation exhaust all available memory.
+constexpr auto MAX_CAPACITY = (int32_t)JPH::BodyID::cMaxBodyIndex;
+
+// See `JoltSpace3D::try_optimize` for where this number comes from
+constexpr int32_t MAX_UNOPTIMIZED_BATCHES = 128;
+
+bool try_grow_capacity(int32_t& p_capacity, int32_t p_current) {
+	if (p_current >= MAX_CAPACITY) {
+		return false;
+	}
+
+	p_capacity = MAX(p_capacity, (int32_t)MIN((int64_t)p_current * 2, (int64_t)MAX_CAPACITY));
+
+	return true;
+}
+
+template<typename TValue>
+uint32_t hash_bits(TValue p_value, uint32_t p_seed) {
+	// We hash the raw bits rather than the values themselves, since hashing functions like
+	// `hash_murmur3_one_float` treat negative zero and positive zero as the same value, which would
+	// hide the very differences we're trying to detect.
+	if constexpr (sizeof(TValue) == sizeof(uint64_t)) {
+		uint64_t bits = 0;
+		memcpy(&bits, &p_value, sizeof(bits));
+		return hash_murmur3_one_64(bits, p_seed);
+	} else {
+		uint32_t bits = 0;
+		memcpy(&bits, &p_value, sizeof(bits));
+		return hash_murmur3_one_32(bits, p_seed);
+	}
+}
+
+template<typename TVector>
+uint32_t hash_vector(const TVector& p_vector, uint32_t p_seed) {
+	uint32_t hash = hash_bits(p_vector.GetX(), p_seed);
+	hash = hash_bits(p_vector.GetY(), hash);
+	hash = hash_bits(p_vector.GetZ(), hash);
+	return hash;
+}
 
 } // namespace
 
+JoltSpace3D::ModificationLock::ModificationLock(JoltSpace3D& p_space) {
+	const std::thread::id this_thread = std::this_thread::get_id();
+
+	if (p_space.modifying_thread.load(std::memory_order_relaxed) == this_thread) {
+		return;
+	}
+
+	p_space.query_mutex.lock();
+	p_space.modifying_thread.store(this_thread, std::memory_order_relaxed);
+
+	space = &p_space;
+}
+
+JoltSpace3D::ModificationLock::~ModificationLock() {
+	if (space == nullptr) {
+		return;
+	}
+
+	space->modifying_thread.store(std::thread::id(), std::memory_order_relaxed);
+	space->query_mutex.unlock();
+}
+
 JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 	: body_accessor(this)
 	, job_system(p_job_system)
 	, temp_allocator(new JoltTempAllocator())
 	, layer_mapper(new JoltLayerMapper())
 	, contact_listener(new JoltContactListener3D(this))
-	, physics_system(new JPH::PhysicsSystem()) {
-	physics_system->Init(
-		(JPH::uint)JoltProjectSettings::get_max_bodies(),
-		0,
-		(JPH::uint)JoltProjectSettings::get_max_pairs(),
-		(JPH::uint)JoltProjectSettings::get_max_contact_constraints(),
-		*layer_mapper,
-		*layer_mapper,
-		*layer_mapper
-	);
+	, state_recorder(new JoltStateRecorder())
+	, projectile_system(new JoltProjectileSystem3D(this))
+	, max_bodies(JoltProjectSettings::get_max_bodies())
+	, max_body_pairs(JoltProjectSettings::get_max_pairs())
+	, max_contact_constraints(JoltProjectSettings::get_max_contact_constraints()) {
+	physics_system = _create_physics_system();
 
 	JPH::PhysicsSettings settings;
 	settings.mBaumgarte = JoltProjectSettings::get_position_correction();
@@ -59,26 +121,10 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 
 	physics_system->SetPhysicsSettings(settings);
 	physics_system->SetGravity(JPH::Vec3::sZero());
-	physics_system->SetContactListener(contact_listener);
-	physics_system->SetSoftBodyContactListener(contact_listener);
-
-	physics_system->SetCombineFriction(
-		[](const JPH::Body& p_body1,
-		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id1,
-		   const JPH::Body& p_body2,
-		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id2) {
-			return ABS(MIN(p_body1.GetFriction(), p_body2.GetFriction()));
-		}
-	);
 
-	physics_system->SetCombineRestitution(
-		[](const JPH::Body& p_body1,
-		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id1,
-		   const JPH::Body& p_body2,
-		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id2) {
-			return CLAMP(p_body1.GetRestitution() + p_body2.GetRestitution(), 0.0f, 1.0f);
-		}
-	);
+	// This is created up front rather than on first use, since the direct state can be requested
+	// from multiple threads at once.
+	direct_state = memnew(JoltPhysicsDirectSpaceState3DExtension(this));
 
 #ifdef GDJ_CONFIG_EDITOR
 	// HACK(mihe): The `EditorLog` class gets initialized fairly late in the application flow, so if
@@ -96,56 +142,61 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 JoltSpace3D::~JoltSpace3D() {
 	memdelete_safely(direct_state);
 	delete_safely(physics_system);
+	delete_safely(projectile_system);
+	delete_safely(state_recorder);
 	delete_safely(contact_listener);
 	delete_safely(layer_mapper);
 	delete_safely(temp_allocator);
 }
 
 void JoltSpace3D::step(float p_step) {
+	const ModificationLock modification_lock(*this);
+
 	last_step = p_step;
 
+	if (rebuild_pending) {
+		_rebuild_physics_system();
+	}
+
+	stepping = true;
+
+	add_pending_bodies();
+
 	_pre_step(p_step);
 
-	const JPH::EPhysicsUpdateError
-		update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
+	JPH::EPhysicsUpdateError update_error = JPH::EPhysicsUpdateError::None;
 
-	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) !=
-		JPH::EPhysicsUpdateError::None)
 	{
-		WARN_PRINT_ONCE(vformat(
-			"Jolt's manifold cache exceeded capacity and contacts were ignored. "
-			"Consider increasing maximum number of contact constraints in project settings. "
-			"Maximum number of contact constraints is currently set to %d.",
-			JoltProjectSettings::get_max_contact_constraints()
-		));
+		const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_STEP);
+		update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
 	}
 
-	if ((update_error & JPH::EPhysicsUpdateError::BodyPairCacheFull) !=
-		JPH::EPhysicsUpdateError::None)
-	{
-		WARN_PRINT_ONCE(vformat(
-			"Jolt's body pair cache exceeded capacity and contacts were ignored. "
-			"Consider increasing maximum number of body pairs in project settings. "
-			"Maximum number of body pairs is currently set to %d.",
-			JoltProjectSettings::get_max_pairs()
-		));
+	if (update_error != JPH::EPhysicsUpdateError::None) {
+		_grow_capacities(update_error);
 	}
 
-	if ((update_error & JPH::EPhysicsUpdateError::ContactConstraintsFull) !=
-		JPH::EPhysicsUpdateError::None)
-	{
-		WARN_PRINT_ONCE(vformat(
-			"Jolt's contact constraint buffer exceeded capacity and contacts were ignored. "
-			"Consider increasing maximum number of contact constraints in project settings. "
-			"Maximum number of contact constraints is currently set to %d.",
-			JoltProjectSettings::get_max_contact_constraints()
-		));
+	_post_step(p_step);
+
+	if (!projectile_system->is_empty()) {
+		projectile_system->step(p_step, *job_system);
 	}
 
-	_post_step(p_step);
+	_release_pooled_bodies();
+
+	stepping = false;
+
+	if (rebuild_pending) {
+		_rebuild_physics_system();
+	}
+
+	if (deterministic) {
+		_update_state_hash();
+	}
 
+	step_count += 1;
 	has_stepped = true;
 	bodies_added_since_optimizing = 0;
+	broad_phase_layers_to_optimize = 0;
 }
 
 void JoltSpace3D::call_queries() {
@@ -186,30 +237,32 @@ void JoltSpace3D::call_queries() {
 }
 
 double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
+	const JPH::PhysicsSettings& settings = physics_system->GetPhysicsSettings();
+
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS: {
-			return DEFAULT_CONTACT_RECYCLE_RADIUS;
+			return Math::sqrt(settings.mContactPointPreserveLambdaMaxDistSq);
 		}
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_SEPARATION: {
-			return DEFAULT_CONTACT_MAX_SEPARATION;
+			return settings.mSpeculativeContactDistance;
 		}
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_ALLOWED_PENETRATION: {
-			return DEFAULT_CONTACT_MAX_ALLOWED_PENETRATION;
+			return settings.mPenetrationSlop;
 		}
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_DEFAULT_BIAS: {
-			return DEFAULT_CONTACT_DEFAULT_BIAS;
+			return settings.mBaumgarte;
 		}
 		case PhysicsServer3D::SPACE_PARAM_BODY_LINEAR_VELOCITY_SLEEP_THRESHOLD: {
-			return DEFAULT_SLEEP_THRESHOLD_LINEAR;
+			return settings.mPointVelocitySleepThreshold;
 		}
 		case PhysicsServer3D::SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD: {
 			return DEFAULT_SLEEP_THRESHOLD_ANGULAR;
 		}
 		case PhysicsServer3D::SPACE_PARAM_BODY_TIME_TO_SLEEP: {
-			return JoltProjectSettings::get_sleep_time_threshold();
+			return settings.mTimeBeforeSleep;
 		}
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
-			return DEFAULT_SOLVER_ITERATIONS;
+			return settings.mNumVelocitySteps;
 		}
 		default: {
 			ERR_FAIL_D_REPORT(vformat("Unhandled space parameter: '%d'.", p_param));
@@ -217,40 +270,24 @@ double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 	}
 }
 
-void JoltSpace3D::set_param(
-	PhysicsServer3D::SpaceParameter p_param,
-	[[maybe_unused]] double p_value
-) {
+void JoltSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, double p_value) {
+	JPH::PhysicsSettings settings = physics_system->GetPhysicsSettings();
+
 	switch (p_param) {
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_RECYCLE_RADIUS: {
-			WARN_PRINT(
-				"Space-specific contact recycle radius is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mContactPointPreserveLambdaMaxDistSq = (float)(p_value * p_value);
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_SEPARATION: {
-			WARN_PRINT(
-				"Space-specific contact max separation is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mSpeculativeContactDistance = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_ALLOWED_PENETRATION: {
-			WARN_PRINT(
-				"Space-specific contact max allowed penetration is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mPenetrationSlop = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_CONTACT_DEFAULT_BIAS: {
-			WARN_PRINT(
-				"Space-specific contact default bias is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mBaumgarte = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_BODY_LINEAR_VELOCITY_SLEEP_THRESHOLD: {
-			WARN_PRINT(
-				"Space-specific linear velocity sleep threshold is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mPointVelocitySleepThreshold = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD: {
 			WARN_PRINT(
@@ -259,21 +296,368 @@ void JoltSpace3D::set_param(
 			);
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_BODY_TIME_TO_SLEEP: {
-			WARN_PRINT(
-				"Space-specific body sleep time is not supported by Godot Jolt. "
-				"Any such value will be ignored."
-			);
+			settings.mTimeBeforeSleep = (float)p_value;
 		} break;
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
-			WARN_PRINT(
-				"Space-specific solver iterations is not supported by Godot Jolt. "
-				"Any such value will be ignored."
+			ERR_FAIL_COND_MSG(
+				p_value < 1,
+				vformat("Solver iterations must be at least 1. Got: %d.", (int32_t)p_value)
 			);
+
+			settings.mNumVelocitySteps = (JPH::uint)p_value;
 		} break;
 		default: {
 			ERR_FAIL_REPORT(vformat("Unhandled space parameter: '%d'.", p_param));
 		} break;
 	}
+
+	physics_system->SetPhysicsSettings(settings);
+}
+
+double JoltSpace3D::get_soft_body_lod_param(SoftBodyLODParameter p_param) const {
+	switch (p_param) {
+		case SPACE_SOFT_BODY_LOD_REDUCE_DISTANCE: {
+			return soft_body_lod_reduce_distance;
+		}
+		case SPACE_SOFT_BODY_LOD_SKIP_DISTANCE: {
+			return soft_body_lod_skip_distance;
+		}
+		case SPACE_SOFT_BODY_LOD_FREEZE_DISTANCE: {
+			return soft_body_lod_freeze_distance;
+		}
+		case SPACE_SOFT_BODY_LOD_PRECISION: {
+			return soft_body_lod_precision;
+		}
+		case SPACE_SOFT_BODY_LOD_SKIP_INTERVAL: {
+			return soft_body_lod_skip_interval;
+		}
+		default: {
+			ERR_FAIL_D_REPORT(vformat("Unhandled soft body LOD parameter: '%d'.", p_param));
+		}
+	}
+}
+
+void JoltSpace3D::set_soft_body_lod_param(SoftBodyLODParameter p_param, double p_value) {
+	switch (p_param) {
+		case SPACE_SOFT_BODY_LOD_REDUCE_DISTANCE: {
+			soft_body_lod_reduce_distance = MAX((float)p_value, 0.0f);
+		} break;
+		case SPACE_SOFT_BODY_LOD_SKIP_DISTANCE: {
+			soft_body_lod_skip_distance = MAX((float)p_value, 0.0f);
+		} break;
+		case SPACE_SOFT_BODY_LOD_FREEZE_DISTANCE: {
+			soft_body_lod_freeze_distance = MAX((float)p_value, 0.0f);
+		} break;
+		case SPACE_SOFT_BODY_LOD_PRECISION: {
+			soft_body_lod_precision = MAX((int32_t)p_value, 1);
+		} break;
+		case SPACE_SOFT_BODY_LOD_SKIP_INTERVAL: {
+			soft_body_lod_skip_interval = MAX((int32_t)p_value, 1);
+		} break;
+		default: {
+			ERR_FAIL_REPORT(vformat("Unhandled soft body LOD parameter: '%d'.", p_param));
+		} break;
+	}
+}
+
+JoltSoftBodyLOD JoltSpace3D::get_soft_body_lod(const JPH::AABox& p_bounds) const {
+	const float distance_sq = p_bounds.GetSqDistanceTo(to_jolt(soft_body_lod_reference));
+
+	// A distance of zero means that particular band is disabled
+	auto is_beyond = [&](float p_distance) {
+		return p_distance > 0.0f && distance_sq >= p_distance * p_distance;
+	};
+
+	if (is_beyond(soft_body_lod_freeze_distance)) {
+		return JOLT_SOFT_BODY_LOD_FROZEN;
+	} else if (is_beyond(soft_body_lod_skip_distance)) {
+		return JOLT_SOFT_BODY_LOD_SKIPPED;
+	} else if (is_beyond(soft_body_lod_reduce_distance)) {
+		return JOLT_SOFT_BODY_LOD_REDUCED;
+	} else {
+		return JOLT_SOFT_BODY_LOD_FULL;
+	}
+}
+
+bool JoltSpace3D::is_soft_body_step_skipped(const JPH::BodyID& p_body_id) const {
+	// We offset by the body index to stagger the steps, so that all the soft bodies in this band
+	// don't end up being simulated during the same step.
+	const uint64_t offset = p_body_id.GetIndex();
+	return (step_count + offset) % (uint64_t)soft_body_lod_skip_interval != 0;
+}
+
+bool JoltSpace3D::is_contact_stream_enabled() const {
+	return contact_listener->is_contact_stream_enabled();
+}
+
+void JoltSpace3D::set_contact_stream_enabled(bool p_enabled) {
+	contact_listener->set_contact_stream_enabled(p_enabled);
+}
+
+Dictionary JoltSpace3D::get_contact_stream() const {
+	return contact_listener->get_contact_stream();
+}
+
+void JoltSpace3D::set_deterministic(bool p_enabled) {
+	if (deterministic == p_enabled) {
+		return;
+	}
+
+	deterministic = p_enabled;
+	state_hash = 0;
+	teleported_bodies.clear();
+
+	contact_listener->set_deterministic(p_enabled);
+}
+
+Dictionary JoltSpace3D::get_interpolated_transforms(float p_fraction) {
+	body_accessor.acquire_all();
+
+	const int32_t body_count = body_accessor.get_count();
+
+	TypedArray<RID> rids;
+	rids.resize(body_count);
+
+	PackedFloat32Array transforms;
+	transforms.resize(body_count * 12);
+
+	float* transforms_ptr = transforms.ptrw();
+	int32_t index = 0;
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		const JPH::Body* jolt_body = body_accessor.try_get(i);
+
+		if (jolt_body == nullptr || jolt_body->IsSensor() || jolt_body->IsSoftBody()) {
+			continue;
+		}
+
+		const auto* body = reinterpret_cast<const JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+		if (body->is_static()) {
+			continue;
+		}
+
+		const Transform3D transform = body->get_interpolated_transform(p_fraction);
+
+		// This matches the layout used by `MultiMesh` and `RenderingServer.multimesh_set_buffer`
+		float* transform_ptr = transforms_ptr + (ptrdiff_t)index * 12;
+
+		for (int32_t row = 0; row < 3; ++row) {
+			transform_ptr[row * 4 + 0] = (float)transform.basis[row][0];
+			transform_ptr[row * 4 + 1] = (float)transform.basis[row][1];
+			transform_ptr[row * 4 + 2] = (float)transform.basis[row][2];
+			transform_ptr[row * 4 + 3] = (float)transform.origin[row];
+		}
+
+		rids[index] = body->get_rid();
+
+		index += 1;
+	}
+
+	body_accessor.release();
+
+	rids.resize(index);
+	transforms.resize(index * 12);
+
+	Dictionary result;
+	result["rids"] = rids;
+	result["transforms"] = transforms;
+	return result;
+}
+
+void JoltSpace3D::shift_origin(const Vector3& p_offset) {
+	ERR_FAIL_COND_MSG(
+		stepping || body_accessor.is_acquired(),
+		vformat(
+			"Failed to shift origin of physics space with RID '%d'. "
+			"The origin can't be shifted while the space is being stepped or flushing queries.",
+			rid.get_id()
+		)
+	);
+
+	const ModificationLock modification_lock(*this);
+
+	add_pending_bodies();
+
+	const JPH::RVec3 offset = to_jolt_r(p_offset);
+
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	body_accessor.acquire_all();
+
+	const int32_t body_count = body_accessor.get_count();
+
+	// Moving a body only updates its bounds in the broad-phase, in place, which means the
+	// broad-phase tree is left intact, albeit with some very loose nodes until it's rebuilt at the
+	// next step. Bodies are also moved without being activated, so sleeping ones stay asleep.
+	auto shift_bodies = [&](int32_t p_begin, int32_t p_end) {
+		for (int32_t i = p_begin; i < p_end; ++i) {
+			JPH::Body* jolt_body = body_accessor.try_get(i);
+
+			if (jolt_body == nullptr) {
+				continue;
+			}
+
+			body_iface.SetPositionAndRotation(
+				jolt_body->GetID(),
+				jolt_body->GetPosition() + offset,
+				jolt_body->GetRotation(),
+				JPH::EActivation::DontActivate
+			);
+
+			if (!jolt_body->IsSensor() && !jolt_body->IsSoftBody()) {
+				reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData())->shift_origin(p_offset);
+			}
+		}
+	};
+
+	const int32_t batch_count = (body_count + ORIGIN_SHIFT_BATCH_SIZE - 1) /
+		ORIGIN_SHIFT_BATCH_SIZE;
+
+	if (batch_count <= 1) {
+		shift_bodies(0, body_count);
+	} else {
+		JPH::JobSystem::Barrier* barrier = job_system->CreateBarrier();
+
+		for (int32_t i = 0; i < batch_count; ++i) {
+			const int32_t begin = i * ORIGIN_SHIFT_BATCH_SIZE;
+			const int32_t end = MIN(begin + ORIGIN_SHIFT_BATCH_SIZE, body_count);
+
+			const JPH::JobHandle job = job_system->CreateJob(
+				"Shift Origin",
+				JPH::Color::sCyan,
+				[&shift_bodies, begin, end]() {
+					shift_bodies(begin, end);
+				}
+			);
+
+			barrier->AddJob(job);
+		}
+
+		job_system->WaitForJobs(barrier);
+		job_system->DestroyBarrier(barrier);
+	}
+
+	// Joints anchored to the world need to be rebuilt, which can't be done in parallel
+	for (int32_t i = 0; i < body_count; ++i) {
+		const JPH::Body* jolt_body = body_accessor.try_get(i);
+
+		if (jolt_body == nullptr || jolt_body->IsSensor() || jolt_body->IsSoftBody()) {
+			continue;
+		}
+
+		const auto* body = reinterpret_cast<const JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+		for (JoltJointImpl3D* joint : body->get_joints()) {
+			joint->shift_origin(p_offset);
+		}
+	}
+
+	body_accessor.release();
+
+	projectile_system->shift_origin(offset);
+
+	soft_body_lod_reference += p_offset;
+
+	if (deterministic) {
+		// Every body is moved by the same offset, so folding the offset itself into the hash covers
+		// all of them, including the sleeping and static ones.
+		state_hash = hash_fmix32(hash_vector(offset, state_hash));
+	}
+
+	// Spaces that aren't being stepped still need their broad-phase rebuilt
+	bodies_added_since_optimizing += 1;
+}
+
+int64_t JoltSpace3D::add_projectiles(
+	const PackedVector3Array& p_positions,
+	const PackedVector3Array& p_velocities,
+	float p_radius,
+	float p_gravity_scale,
+	float p_lifetime,
+	uint32_t p_collision_mask
+) {
+	return projectile_system->add(
+		p_positions,
+		p_velocities,
+		p_radius,
+		p_gravity_scale,
+		p_lifetime,
+		p_collision_mask
+	);
+}
+
+void JoltSpace3D::clear_projectiles() {
+	projectile_system->clear();
+}
+
+Dictionary JoltSpace3D::get_projectiles() const {
+	return projectile_system->get_projectiles();
+}
+
+Dictionary JoltSpace3D::get_projectile_hits() const {
+	return projectile_system->get_hits();
+}
+
+void JoltSpace3D::set_max_pooled_bodies(int32_t p_count) {
+	max_pooled_bodies = MAX(p_count, 0);
+
+	if (pooled_body_ids.size() > max_pooled_bodies) {
+		const ModificationLock modification_lock(*this);
+		_trim_pooled_bodies();
+	}
+}
+
+int32_t JoltSpace3D::get_capacity(Capacity p_capacity) const {
+	switch (p_capacity) {
+		case SPACE_CAPACITY_MAX_BODIES: {
+			return max_bodies;
+		}
+		case SPACE_CAPACITY_MAX_BODY_PAIRS: {
+			return max_body_pairs;
+		}
+		case SPACE_CAPACITY_MAX_CONTACT_CONSTRAINTS: {
+			return max_contact_constraints;
+		}
+		default: {
+			ERR_FAIL_D_REPORT(vformat("Unhandled space capacity: '%d'.", p_capacity));
+		}
+	}
+}
+
+void JoltSpace3D::set_capacity(Capacity p_capacity, int32_t p_value) {
+	const int32_t value = CLAMP(p_value, MIN_CAPACITY, MAX_CAPACITY);
+
+	switch (p_capacity) {
+		case SPACE_CAPACITY_MAX_BODIES: {
+			if (value == max_bodies) {
+				return;
+			}
+
+			max_bodies = value;
+		} break;
+		case SPACE_CAPACITY_MAX_BODY_PAIRS: {
+			if (value == max_body_pairs) {
+				return;
+			}
+
+			max_body_pairs = value;
+		} break;
+		case SPACE_CAPACITY_MAX_CONTACT_CONSTRAINTS: {
+			if (value == max_contact_constraints) {
+				return;
+			}
+
+			max_contact_constraints = value;
+		} break;
+		default: {
+			ERR_FAIL_REPORT(vformat("Unhandled space capacity: '%d'.", p_capacity));
+		} break;
+	}
+
+	const ModificationLock modification_lock(*this);
+
+	_capacity_changed();
 }
 
 JPH::BodyInterface& JoltSpace3D::get_body_iface() {
@@ -301,6 +685,9 @@ JPH::ObjectLayer JoltSpace3D::map_to_object_layer(
 	uint32_t p_collision_layer,
 	uint32_t p_collision_mask
 ) {
+	// Mapping a new combination of layers grows the mapper, which queries read from
+	const ModificationLock modification_lock(*this);
+
 	return layer_mapper->to_object_layer(p_broad_phase_layer, p_collision_layer, p_collision_mask);
 }
 
@@ -344,14 +731,6 @@ JoltWritableBodies3D JoltSpace3D::write_bodies(const JPH::BodyID* p_body_ids, in
 	return {*this, p_body_ids, p_body_count};
 }
 
-JoltPhysicsDirectSpaceState3DExtension* JoltSpace3D::get_direct_state() {
-	if (direct_state == nullptr) {
-		direct_state = memnew(JoltPhysicsDirectSpaceState3DExtension(this));
-	}
-
-	return direct_state;
-}
-
 void JoltSpace3D::set_default_area(JoltAreaImpl3D* p_area) {
 	if (default_area == p_area) {
 		return;
@@ -366,88 +745,243 @@ void JoltSpace3D::set_default_area(JoltAreaImpl3D* p_area) {
 	if (default_area != nullptr) {
 		default_area->set_default_area(true);
 	}
+
+	area_overrides_changed();
 }
 
 JPH::BodyID JoltSpace3D::add_rigid_body(
 	const JoltObjectImpl3D& p_object,
 	const JPH::BodyCreationSettings& p_settings
 ) {
-	const JPH::BodyID body_id = get_body_iface().CreateAndAddBody(
-		p_settings,
-		// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or
-		// less impossible to have a body be sleeping when created, so we default to always starting
-		// out as awake/active.
-		JPH::EActivation::Activate
-	);
+	const ModificationLock modification_lock(*this);
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_BODIES);
 
-	ERR_FAIL_COND_D_MSG(
-		body_id.IsInvalid(),
-		vformat(
-			"Failed to create underlying Jolt body for '%s'. "
-			"Consider increasing maximum number of bodies in project settings. "
-			"Maximum number of bodies is currently set to %d.",
+	if (!p_settings.mIsSensor && has_pooled_bodies()) {
+		const JPH::BodyID pooled_id = _try_reuse_pooled_body(p_settings);
+
+		if (!pooled_id.IsInvalid()) {
+			_add_pending_body(pooled_id);
+			return pooled_id;
+		}
+	}
+
+	JPH::Body* body = get_body_iface().CreateBody(p_settings);
+
+	if (body == nullptr && _try_grow_max_bodies()) {
+		body = get_body_iface().CreateBody(p_settings);
+	}
+
+	ERR_FAIL_NULL_D_MSG(
+		body,
+		vformat(
+			"Failed to create underlying Jolt body for '%s'. "
+			"Maximum number of bodies for physics space with RID '%d' is currently %d.",
 			p_object.to_string(),
-			JoltProjectSettings::get_max_bodies()
+			rid.get_id(),
+			(int32_t)physics_system->GetMaxBodies()
 		)
 	);
 
-	bodies_added_since_optimizing += 1;
+	_add_pending_body(body->GetID());
 
-	return body_id;
+	return body->GetID();
 }
 
 JPH::BodyID JoltSpace3D::add_soft_body(
 	const JoltObjectImpl3D& p_object,
 	const JPH::SoftBodyCreationSettings& p_settings
 ) {
-	const JPH::BodyID body_id = get_body_iface().CreateAndAddSoftBody(
-		p_settings,
-		JPH::EActivation::Activate
-	);
+	const ModificationLock modification_lock(*this);
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_SOFT_BODIES);
 
-	ERR_FAIL_COND_D_MSG(
-		body_id.IsInvalid(),
+	JPH::Body* body = get_body_iface().CreateSoftBody(p_settings);
+
+	if (body == nullptr && _try_grow_max_bodies()) {
+		body = get_body_iface().CreateSoftBody(p_settings);
+	}
+
+	ERR_FAIL_NULL_D_MSG(
+		body,
 		vformat(
 			"Failed to create underlying Jolt body for '%s'. "
-			"Consider increasing maximum number of bodies in project settings. "
-			"Maximum number of bodies is currently set to %d.",
+			"Maximum number of bodies for physics space with RID '%d' is currently %d.",
 			p_object.to_string(),
-			JoltProjectSettings::get_max_bodies()
+			rid.get_id(),
+			(int32_t)physics_system->GetMaxBodies()
 		)
 	);
 
-	bodies_added_since_optimizing += 1;
+	_add_pending_body(body->GetID());
 
-	return body_id;
+	return body->GetID();
+}
+
+void JoltSpace3D::add_pending_bodies() {
+	if (pending_bodies.is_empty()) {
+		return;
+	}
+
+	const ModificationLock modification_lock(*this);
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_BROAD_PHASE);
+
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	if (deterministic) {
+		// Bodies are otherwise added in whatever order they happened to be created in, which can
+		// differ between runs even when the resulting set of bodies is the same.
+		pending_bodies.sort();
+	}
+
+	const auto body_count = (int)pending_bodies.size();
+
+	// Adding bodies in bulk like this lets Jolt build a balanced tree out of them up front, which
+	// it then inserts into the broad-phase as a single node, rather than inserting them one by one.
+	const JPH::BodyInterface::AddState
+		add_state = body_iface.AddBodiesPrepare(pending_bodies.ptr(), body_count);
+
+	body_iface.AddBodiesFinalize(
+		pending_bodies.ptr(),
+		body_count,
+		add_state,
+		// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or
+		// less impossible to have a body be sleeping when created, so we default to always starting
+		// out as awake/active.
+		JPH::EActivation::Activate
+	);
+
+	pending_bodies.clear();
+	pending_body_indices.clear();
+
+	bodies_added_since_optimizing += 1;
 }
 
-void JoltSpace3D::remove_body(const JPH::BodyID& p_body_id) {
+void JoltSpace3D::remove_body(const JPH::BodyID& p_body_id, bool p_poolable) {
+	const ModificationLock modification_lock(*this);
+
 	JPH::BodyInterface& body_iface = get_body_iface();
 
-	body_iface.RemoveBody(p_body_id);
+	if (body_iface.IsAdded(p_body_id)) {
+		body_iface.RemoveBody(p_body_id);
+	} else {
+		_remove_pending_body(p_body_id);
+	}
+
+	// Bodies are only pooled when their object is being freed, since an object that merely moves
+	// to another space or leaves its space would otherwise leave a body in the pool for every move.
+	if (p_poolable && _try_pool_body(p_body_id)) {
+		return;
+	}
+
 	body_iface.DestroyBody(p_body_id);
 }
 
 void JoltSpace3D::try_optimize() {
+	add_pending_bodies();
+
 	// HACK(mihe): This makes assumptions about the underlying acceleration structure of Jolt's
 	// broad-phase, which currently uses a quadtree, and which gets walked with a fixed-size node
 	// stack of 128. This means that when the quadtree is completely unbalanced, as is the case if
-	// we add bodies one-by-one without ever stepping the simulation, like in the editor viewport,
-	// we would exceed this stack size (resulting in an incomplete search) as soon as we perform a
-	// physics query after having added somewhere in the order of 128 * 3 bodies. We leave a hefty
-	// margin just in case.
-
-	if (likely(bodies_added_since_optimizing < 128)) {
+	// we add bodies one batch at a time without ever stepping the simulation, like in the editor
+	// viewport, we would exceed this stack size (resulting in an incomplete search) as soon as we
+	// perform a physics query after having added somewhere in the order of 128 * 3 batches. We
+	// leave a hefty margin just in case.
+	//
+	// Note that this is only meant as a last resort, since spaces that are being stepped will have
+	// their broad-phase rebuilt as part of the step, and spaces that aren't will be optimized by
+	// the physics server in between physics ticks, so we should rarely end up doing this here.
+
+	if (likely(bodies_added_since_optimizing < MAX_UNOPTIMIZED_BATCHES)) {
 		return;
 	}
 
+	optimize();
+}
+
+JoltSpace3D::QueryLock JoltSpace3D::lock_for_query() {
+	if (modifying_thread.load(std::memory_order_relaxed) == std::this_thread::get_id()) {
+		// This thread is already modifying the space, like when querying from within the step, so
+		// there's nothing that can run concurrently with the query and nothing to lock.
+		try_optimize();
+		return {};
+	}
+
+	QueryLock query_lock(query_mutex);
+
+	if (likely(!_should_try_optimize())) {
+		return query_lock;
+	}
+
+	// Adding the pending bodies and optimizing the broad-phase can't happen while other threads are
+	// querying, so we trade our shared lock for an exclusive one while we do so.
+	query_lock.unlock();
+
+	{
+		const ModificationLock modification_lock(*this);
+		try_optimize();
+	}
+
+	query_lock.lock();
+
+	return query_lock;
+}
+
+void JoltSpace3D::optimize() {
+	const ModificationLock modification_lock(*this);
+
+	add_pending_bodies();
+
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_BROAD_PHASE);
+
 	physics_system->OptimizeBroadPhase();
 
 	bodies_added_since_optimizing = 0;
+	broad_phase_layers_to_optimize = 0;
+}
+
+void JoltSpace3D::optimize_incrementally() {
+	if (!needs_optimizing()) {
+		return;
+	}
+
+	const ModificationLock modification_lock(*this);
+
+	add_pending_bodies();
+
+	if (broad_phase_layers_to_optimize == 0) {
+		broad_phase_layers_to_optimize = (int32_t)JoltBroadPhaseLayer::COUNT;
+		bodies_added_since_optimizing = 0;
+	}
+
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_BROAD_PHASE);
+
+	// Jolt only exposes the broad-phase of the physics system through its query interface, even
+	// though it's the same object, so we cast our way to the rest of it.
+	auto& broad_phase = const_cast<JPH::BroadPhase&>(
+		static_cast<const JPH::BroadPhase&>(physics_system->GetBroadPhaseQuery())
+	);
+
+	// Much like what happens as part of a physics step, this rebuilds the tree of the next layer
+	// that needs it, if any, and swaps it in. Everything happens on the main thread while holding
+	// the modification lock, so neither queries nor body changes can observe it halfway through.
+	broad_phase.FrameSync();
+	broad_phase.LockModifications();
+
+	const JPH::BroadPhase::UpdateState update_state = broad_phase.UpdatePrepare();
+	broad_phase.UpdateFinalize(update_state);
+
+	broad_phase.UnlockModifications();
+
+	broad_phase_layers_to_optimize -= 1;
 }
 
 void JoltSpace3D::add_joint(JPH::Constraint* p_jolt_ref) {
 	physics_system->AddConstraint(p_jolt_ref);
+
+	// Vehicles do their wheel collision tests as part of the physics step, so they need to be
+	// registered as step listeners as well.
+	if (p_jolt_ref->GetSubType() == JPH::EConstraintSubType::Vehicle) {
+		physics_system->AddStepListener(static_cast<JPH::VehicleConstraint*>(p_jolt_ref));
+	}
 }
 
 void JoltSpace3D::add_joint(JoltJointImpl3D* p_joint) {
@@ -455,6 +989,10 @@ void JoltSpace3D::add_joint(JoltJointImpl3D* p_joint) {
 }
 
 void JoltSpace3D::remove_joint(JPH::Constraint* p_jolt_ref) {
+	if (p_jolt_ref->GetSubType() == JPH::EConstraintSubType::Vehicle) {
+		physics_system->RemoveStepListener(static_cast<JPH::VehicleConstraint*>(p_jolt_ref));
+	}
+
 	physics_system->RemoveConstraint(p_jolt_ref);
 }
 
@@ -462,6 +1000,69 @@ void JoltSpace3D::remove_joint(JoltJointImpl3D* p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+PackedByteArray JoltSpace3D::save_state(const PackedByteArray& p_base) {
+	const ModificationLock modification_lock(*this);
+
+	add_pending_bodies();
+
+	state_recorder->begin_writing();
+	state_recorder->Write(state_hash);
+
+	physics_system->SaveState(*state_recorder);
+
+	return state_recorder->encode(p_base);
+}
+
+bool JoltSpace3D::restore_state(const PackedByteArray& p_state, const PackedByteArray& p_base) {
+	const ModificationLock modification_lock(*this);
+
+	add_pending_bodies();
+
+	QUIET_FAIL_COND_D(!state_recorder->decode(p_state, p_base));
+
+	state_recorder->begin_reading();
+
+	uint32_t restored_state_hash = 0;
+	state_recorder->Read(restored_state_hash);
+
+	ERR_FAIL_COND_D_MSG(
+		!physics_system->RestoreState(*state_recorder),
+		vformat(
+			"Failed to restore state of physics space with RID '%d'. "
+			"The space must contain the same bodies and joints as when the state was saved.",
+			rid.get_id()
+		)
+	);
+
+	// The hash is rolled back along with everything else, so that a space that has resimulated
+	// a number of steps ends up with the same hash as one that never had to.
+	state_hash = restored_state_hash;
+	teleported_bodies.clear();
+
+	contact_listener->state_restored();
+
+	// Bodies that were restored into a sleeping state won't have their state synchronized as part
+	// of the next step, so we need to make sure that it happens regardless.
+
+	body_accessor.acquire_all();
+
+	const int32_t body_count = body_accessor.get_count();
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
+			if (!jolt_body->IsSensor() && !jolt_body->IsSoftBody()) {
+				auto* body = reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+				body->state_restored(*jolt_body);
+			}
+		}
+	}
+
+	body_accessor.release();
+
+	return true;
+}
+
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltSpace3D::dump_debug_snapshot(const String& p_dir) {
@@ -552,16 +1153,12 @@ void JoltSpace3D::_pre_step(float p_step) {
 
 	for (int32_t i = 0; i < body_count; ++i) {
 		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
-				continue;
-			}
-
-			auto* object = reinterpret_cast<JoltShapedObjectImpl3D*>(jolt_body->GetUserData());
+			auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
 
 			object->pre_step(p_step, *jolt_body);
 
 			if (object->reports_contacts()) {
-				contact_listener->listen_for(object);
+				contact_listener->listen_for(object->as_shaped());
 			}
 		}
 	}
@@ -590,3 +1187,489 @@ void JoltSpace3D::_post_step(float p_step) {
 
 	body_accessor.release();
 }
+
+void JoltSpace3D::body_teleported(const JPH::BodyID& p_body_id) {
+	if (deterministic) {
+		teleported_bodies.push_back(p_body_id);
+	}
+}
+
+void JoltSpace3D::_update_state_hash() {
+	// Sleeping bodies can't change their state without first being activated, or without being
+	// teleported, so by only hashing the active and teleported bodies, and folding the result into
+	// the hash of the previous step, we still end up covering every change in state without having
+	// to visit every body. We combine the hashes of individual bodies using addition, so that the
+	// result doesn't depend on the order of Jolt's active bodies.
+	//
+	// Body IDs are deliberately left out of the hash, since which IDs get handed out depends on
+	// things like body pooling and physics system rebuilds rather than the simulation itself.
+
+	const auto hash_body = [](const JPH::Body& p_jolt_body) {
+		uint32_t hash = hash_vector(p_jolt_body.GetPosition(), HASH_MURMUR3_SEED);
+		hash = hash_vector(p_jolt_body.GetRotation(), hash);
+		hash = hash_bits(p_jolt_body.GetRotation().GetW(), hash);
+		hash = hash_vector(p_jolt_body.GetLinearVelocity(), hash);
+		hash = hash_vector(p_jolt_body.GetAngularVelocity(), hash);
+		return hash_fmix32(hash);
+	};
+
+	body_accessor.acquire_active();
+
+	const int32_t body_count = body_accessor.get_count();
+
+	uint32_t bodies_hash = 0;
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		if (const JPH::Body* jolt_body = body_accessor.try_get(i)) {
+			bodies_hash += hash_body(*jolt_body);
+		}
+	}
+
+	body_accessor.release();
+
+	for (const JPH::BodyID& body_id : teleported_bodies) {
+		const JoltReadableBody3D jolt_body = read_body(body_id);
+
+		if (jolt_body.is_valid()) {
+			bodies_hash += hash_body(*jolt_body);
+		}
+	}
+
+	const auto teleported_count = (uint32_t)teleported_bodies.size();
+
+	teleported_bodies.clear();
+
+	state_hash = hash_murmur3_one_32((uint32_t)body_count, state_hash);
+	state_hash = hash_murmur3_one_32(teleported_count, state_hash);
+	state_hash = hash_fmix32(hash_murmur3_one_32(bodies_hash, state_hash));
+}
+
+JPH::BodyID JoltSpace3D::_try_reuse_pooled_body(const JPH::BodyCreationSettings& p_settings) {
+	LocalVector<JPH::BodyID>* pooled_ids = body_pool.getptr(p_settings.mObjectLayer);
+
+	if (pooled_ids == nullptr || pooled_ids->is_empty()) {
+		return {};
+	}
+
+	const int32_t last_index = pooled_ids->size() - 1;
+	const JPH::BodyID body_id = (*pooled_ids)[last_index];
+
+	pooled_ids->remove_at(last_index);
+	pooled_body_ids.erase(body_id);
+
+	{
+		const JoltWritableBody3D body = write_body(body_id);
+		ERR_FAIL_COND_D(body.is_invalid());
+
+		// Anything that can differ between two bodies sharing the same object layer needs to be
+		// reset here, so that the result is indistinguishable from a freshly created body.
+
+		if (body->GetShape() != p_settings.GetShape()) {
+			body->SetShapeInternal(p_settings.GetShape(), false);
+		}
+
+		body->SetUserData(p_settings.mUserData);
+		body->SetCollisionGroup(p_settings.mCollisionGroup);
+		body->SetMotionType(p_settings.mMotionType);
+		body->SetAllowSleeping(p_settings.mAllowSleeping);
+		body->SetCollideKinematicVsNonDynamic(p_settings.mCollideKinematicVsNonDynamic);
+		body->SetUseManifoldReduction(p_settings.mUseManifoldReduction);
+		body->SetEnhancedInternalEdgeRemoval(p_settings.mEnhancedInternalEdgeRemoval);
+		body->SetFriction(p_settings.mFriction);
+		body->SetRestitution(p_settings.mRestitution);
+		body->SetPositionAndRotationInternal(p_settings.mPosition, p_settings.mRotation);
+
+		JPH::MotionProperties& motion_properties = *body->GetMotionPropertiesUnchecked();
+		motion_properties.SetMassProperties(
+			p_settings.mAllowedDOFs,
+			p_settings.GetMassProperties()
+		);
+		motion_properties.SetLinearDamping(p_settings.mLinearDamping);
+		motion_properties.SetAngularDamping(p_settings.mAngularDamping);
+		motion_properties.SetMaxLinearVelocity(p_settings.mMaxLinearVelocity);
+		motion_properties.SetMaxAngularVelocity(p_settings.mMaxAngularVelocity);
+		motion_properties.SetGravityFactor(p_settings.mGravityFactor);
+		motion_properties.SetNumVelocityStepsOverride(p_settings.mNumVelocityStepsOverride);
+		motion_properties.SetNumPositionStepsOverride(p_settings.mNumPositionStepsOverride);
+		motion_properties.ResetForce();
+		motion_properties.ResetTorque();
+
+		if (!body->IsStatic()) {
+			motion_properties.SetLinearVelocity(p_settings.mLinearVelocity);
+			motion_properties.SetAngularVelocity(p_settings.mAngularVelocity);
+		}
+	}
+
+	get_body_iface().SetMotionQuality(body_id, p_settings.mMotionQuality);
+
+	return body_id;
+}
+
+bool JoltSpace3D::_try_pool_body(const JPH::BodyID& p_body_id) {
+	if (pooled_body_ids.size() >= max_pooled_bodies) {
+		return false;
+	}
+
+	const JoltWritableBody3D body = write_body(p_body_id);
+	ERR_FAIL_COND_D(body.is_invalid());
+
+	if (body->IsSensor() || body->IsSoftBody()) {
+		return false;
+	}
+
+	// The object that owned this body is about to be freed, so we make sure nothing can reach it
+	// through the body while it sits in the pool.
+	body->SetUserData(0);
+
+	pooled_body_ids.insert(p_body_id);
+	bodies_pooled_this_step.push_back({p_body_id, body->GetObjectLayer()});
+
+	return true;
+}
+
+void JoltSpace3D::_release_pooled_bodies() {
+	// Bodies that were pooled during a step can't be reused until Jolt has stepped at least once
+	// without them, since until then it will still have contacts and cached manifolds referring to
+	// their IDs, which would otherwise end up being attributed to whatever object reuses the body,
+	// causing things like missed area enter events.
+
+	for (const PooledBody& pooled_body : bodies_pooled_this_step) {
+		body_pool[pooled_body.object_layer].push_back(pooled_body.id);
+	}
+
+	bodies_pooled_this_step.clear();
+}
+
+void JoltSpace3D::_trim_pooled_bodies() {
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	int32_t excess_count = pooled_body_ids.size() - max_pooled_bodies;
+
+	auto destroy_body = [&](const JPH::BodyID& p_body_id) {
+		body_iface.DestroyBody(p_body_id);
+		pooled_body_ids.erase(p_body_id);
+		excess_count -= 1;
+	};
+
+	// Bodies pooled during this step are the ones furthest from being reused, so they go first
+	while (excess_count > 0 && !bodies_pooled_this_step.is_empty()) {
+		const int32_t last_index = bodies_pooled_this_step.size() - 1;
+		destroy_body(bodies_pooled_this_step[last_index].id);
+		bodies_pooled_this_step.remove_at(last_index);
+	}
+
+	for (auto& [object_layer, pooled_ids] : body_pool) {
+		while (excess_count > 0 && !pooled_ids.is_empty()) {
+			const int32_t last_index = pooled_ids.size() - 1;
+			destroy_body(pooled_ids[last_index]);
+			pooled_ids.remove_at(last_index);
+		}
+	}
+}
+
+void JoltSpace3D::_destroy_pooled_bodies() {
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	for (const JPH::BodyID& body_id : pooled_body_ids) {
+		body_iface.DestroyBody(body_id);
+	}
+
+	pooled_body_ids.clear();
+	bodies_pooled_this_step.clear();
+	body_pool.clear();
+}
+
+JPH::PhysicsSystem* JoltSpace3D::_create_physics_system() const {
+	const JoltAllocationScope allocation_scope(JOLT_ALLOCATION_TAG_PHYSICS_SYSTEM);
+
+	auto* new_physics_system = new JPH::PhysicsSystem();
+
+	new_physics_system->Init(
+		(JPH::uint)max_bodies,
+		0,
+		(JPH::uint)max_body_pairs,
+		(JPH::uint)max_contact_constraints,
+		*layer_mapper,
+		*layer_mapper,
+		*layer_mapper
+	);
+
+	new_physics_system->SetContactListener(contact_listener);
+	new_physics_system->SetSoftBodyContactListener(contact_listener);
+
+	new_physics_system->SetCombineFriction(
+		[](const JPH::Body& p_body1,
+		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id1,
+		   const JPH::Body& p_body2,
+		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id2) {
+			return ABS(MIN(p_body1.GetFriction(), p_body2.GetFriction()));
+		}
+	);
+
+	new_physics_system->SetCombineRestitution(
+		[](const JPH::Body& p_body1,
+		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id1,
+		   const JPH::Body& p_body2,
+		   [[maybe_unused]] const JPH::SubShapeID& p_sub_shape_id2) {
+			return CLAMP(p_body1.GetRestitution() + p_body2.GetRestitution(), 0.0f, 1.0f);
+		}
+	);
+
+	return new_physics_system;
+}
+
+void JoltSpace3D::_add_pending_body(const JPH::BodyID& p_body_id) {
+	pending_body_indices.insert(p_body_id, pending_bodies.size());
+	pending_bodies.push_back(p_body_id);
+}
+
+void JoltSpace3D::_remove_pending_body(const JPH::BodyID& p_body_id) {
+	// Bodies can be freed before they're ever added, like when streaming in a chunk of the world
+	// only to unload it again right away, so this needs to avoid scanning the pending bodies.
+	const auto iter = pending_body_indices.find(p_body_id);
+
+	if (iter == pending_body_indices.end()) {
+		return;
+	}
+
+	const int32_t index = iter->second;
+	const JPH::BodyID last_body_id = pending_bodies[pending_bodies.size() - 1];
+
+	pending_bodies.remove_at_unordered(index);
+	pending_body_indices.remove(iter);
+
+	if (last_body_id != p_body_id) {
+		pending_body_indices[last_body_id] = index;
+	}
+}
+
+bool JoltSpace3D::_should_try_optimize() const {
+	return !pending_bodies.is_empty() || bodies_added_since_optimizing >= MAX_UNOPTIMIZED_BATCHES;
+}
+
+bool JoltSpace3D::_try_grow_max_bodies() {
+	if (!try_grow_capacity(max_bodies, (int32_t)physics_system->GetMaxBodies())) {
+		return false;
+	}
+
+	WARN_PRINT(vformat(
+		"Physics space with RID '%d' exceeded its maximum number of bodies. "
+		"Maximum number of bodies will be increased to %d.",
+		rid.get_id(),
+		max_bodies
+	));
+
+	if (!_can_rebuild_physics_system()) {
+		// We can't replace the physics system while it's being stepped or while its bodies are
+		// being iterated over, so this particular body will fail to be created, but any created
+		// after the next step won't.
+		rebuild_pending = true;
+		return false;
+	}
+
+	_rebuild_physics_system();
+
+	return true;
+}
+
+void JoltSpace3D::_grow_capacities(JPH::EPhysicsUpdateError p_update_error) {
+	auto has_error = [&](JPH::EPhysicsUpdateError p_error) {
+		return (p_update_error & p_error) != JPH::EPhysicsUpdateError::None;
+	};
+
+	if (has_error(JPH::EPhysicsUpdateError::ManifoldCacheFull) ||
+		has_error(JPH::EPhysicsUpdateError::ContactConstraintsFull))
+	{
+		if (try_grow_capacity(max_contact_constraints, max_contact_constraints)) {
+			WARN_PRINT(vformat(
+				"Physics space with RID '%d' exceeded its maximum number of contact constraints "
+				"and contacts were ignored for one step. "
+				"Maximum number of contact constraints will be increased to %d.",
+				rid.get_id(),
+				max_contact_constraints
+			));
+
+			rebuild_pending = true;
+		} else {
+			WARN_PRINT_ONCE(vformat(
+				"Physics space with RID '%d' exceeded its maximum number of contact constraints "
+				"and contacts were ignored. "
+				"Maximum number of contact constraints can't be increased beyond %d.",
+				rid.get_id(),
+				MAX_CAPACITY
+			));
+		}
+	}
+
+	if (has_error(JPH::EPhysicsUpdateError::BodyPairCacheFull)) {
+		if (try_grow_capacity(max_body_pairs, max_body_pairs)) {
+			WARN_PRINT(vformat(
+				"Physics space with RID '%d' exceeded its maximum number of body pairs "
+				"and contacts were ignored for one step. "
+				"Maximum number of body pairs will be increased to %d.",
+				rid.get_id(),
+				max_body_pairs
+			));
+
+			rebuild_pending = true;
+		} else {
+			WARN_PRINT_ONCE(vformat(
+				"Physics space with RID '%d' exceeded its maximum number of body pairs "
+				"and contacts were ignored. "
+				"Maximum number of body pairs can't be increased beyond %d.",
+				rid.get_id(),
+				MAX_CAPACITY
+			));
+		}
+	}
+}
+
+void JoltSpace3D::_rebuild_physics_system() {
+	// Jolt allocates all of its body, pair and contact storage up front when initializing the
+	// physics system, and won't let us initialize it again, so the only way to change any of its
+	// capacities is to create a new physics system and move every body and joint over to it. Bodies
+	// keep their IDs as part of this, so nothing outside of this space needs to know that it
+	// happened, but anything Jolt had cached, like contacts, is lost.
+
+	rebuild_pending = false;
+
+	_destroy_pooled_bodies();
+
+	JPH::PhysicsSystem* old_physics_system = physics_system;
+
+	JPH::BodyIDVector body_ids;
+	old_physics_system->GetBodies(body_ids);
+
+	const JPH::BodyLockInterface& old_lock_iface = old_physics_system->GetBodyLockInterfaceNoLock();
+	const JPH::BodyInterface& old_body_iface = old_physics_system->GetBodyInterfaceNoLock();
+
+	LocalVector<const JPH::Body*> old_bodies;
+	LocalVector<JoltBodyImpl3D*> bodies;
+
+	old_bodies.reserve((int32_t)body_ids.size());
+
+	for (const JPH::BodyID& body_id : body_ids) {
+		const JPH::Body* old_body = old_lock_iface.TryGetBody(body_id);
+		ERR_CONTINUE(old_body == nullptr);
+
+		old_bodies.push_back(old_body);
+
+		// We can't reuse the same IDs if they don't fit within the new capacity
+		max_bodies = MAX(max_bodies, (int32_t)body_id.GetIndex() + 1);
+
+		if (!old_body->IsSensor() && !old_body->IsSoftBody()) {
+			auto* body = reinterpret_cast<JoltBodyImpl3D*>(old_body->GetUserData());
+
+			// Joints hold pointers to the bodies they constrain, so they need to be rebuilt from
+			// scratch once the bodies have moved.
+			body->physics_system_changing();
+
+			bodies.push_back(body);
+		}
+	}
+
+	state_recorder->begin_writing();
+
+	for (const JPH::Body* old_body : old_bodies) {
+		old_body->SaveState(*state_recorder);
+	}
+
+	physics_system = _create_physics_system();
+	physics_system->SetPhysicsSettings(old_physics_system->GetPhysicsSettings());
+	physics_system->SetGravity(old_physics_system->GetGravity());
+
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	LocalVector<JPH::BodyID> active_body_ids;
+	LocalVector<JPH::BodyID> inactive_body_ids;
+
+	state_recorder->begin_reading();
+
+	for (const JPH::Body* old_body : old_bodies) {
+		const JPH::BodyID& body_id = old_body->GetID();
+
+		const JoltAllocationScope allocation_scope(
+			old_body->IsSoftBody() ? JOLT_ALLOCATION_TAG_SOFT_BODIES : JOLT_ALLOCATION_TAG_BODIES
+		);
+
+		JPH::Body* new_body = old_body->IsSoftBody()
+			? body_iface.CreateSoftBodyWithID(body_id, old_body->GetSoftBodyCreationSettings())
+			: body_iface.CreateBodyWithID(body_id, old_body->GetBodyCreationSettings());
+
+		ERR_CONTINUE_MSG(
+			new_body == nullptr,
+			vformat(
+				"Failed to move body '%s' to resized physics space with RID '%d'.",
+				reinterpret_cast<const JoltObjectImpl3D*>(old_body->GetUserData())->to_string(),
+				rid.get_id()
+			)
+		);
+
+		new_body->RestoreState(*state_recorder);
+
+		if (new_body->IsSoftBody()) {
+			// The state of a soft body doesn't include its vertex masses, which we override after
+			// creation to account for things like pinned vertices.
+
+			const auto& old_motion_properties = static_cast<const JPH::SoftBodyMotionProperties&>(
+				*old_body->GetMotionPropertiesUnchecked()
+			);
+
+			auto& new_motion_properties = static_cast<JPH::SoftBodyMotionProperties&>(
+				*new_body->GetMotionPropertiesUnchecked()
+			);
+
+			const auto& old_vertices = old_motion_properties.GetVertices();
+			auto& new_vertices = new_motion_properties.GetVertices();
+
+			for (size_t i = 0; i < new_vertices.size(); ++i) {
+				new_vertices[i].mInvMass = old_vertices[i].mInvMass;
+			}
+		}
+
+		// Bodies that were still pending before are left for `add_pending_bodies` to add
+		if (!old_body_iface.IsAdded(body_id)) {
+			continue;
+		}
+
+		if (old_body->IsActive()) {
+			active_body_ids.push_back(body_id);
+		} else {
+			inactive_body_ids.push_back(body_id);
+		}
+	}
+
+	auto add_bodies = [&](LocalVector<JPH::BodyID>& p_body_ids, JPH::EActivation p_activation) {
+		if (p_body_ids.is_empty()) {
+			return;
+		}
+
+		const auto body_count = (int)p_body_ids.size();
+
+		const JPH::BodyInterface::AddState
+			add_state = body_iface.AddBodiesPrepare(p_body_ids.ptr(), body_count);
+
+		body_iface.AddBodiesFinalize(p_body_ids.ptr(), body_count, add_state, p_activation);
+	};
+
+	add_bodies(active_body_ids, JPH::EActivation::Activate);
+	add_bodies(inactive_body_ids, JPH::EActivation::DontActivate);
+
+	delete_safely(old_physics_system);
+
+	for (JoltBodyImpl3D* body : bodies) {
+		body->physics_system_changed();
+	}
+
+	contact_listener->physics_system_changed();
+
+	bodies_added_since_optimizing += 1;
+}
+
+void JoltSpace3D::_capacity_changed() {
+	if (_can_rebuild_physics_system()) {
+		_rebuild_physics_system();
+	} else {
+		rebuild_pending = true;
+	}
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "spaces/jolt_body_accessor_3d.hpp"
+#include "spaces/jolt_soft_body_lod.hpp"
+#include "spaces/jolt_space_capacity.hpp"
 
 class JoltAreaImpl3D;
 class JoltContactListener3D;
@@ -8,9 +10,51 @@ class JoltJointImpl3D;
 class JoltLayerMapper;
 class JoltObjectImpl3D;
 class JoltPhysicsDirectSpaceState3DExtension;
+class JoltProjectileSystem3D;
+class JoltStateRecorder;
 
 class JoltSpace3D {
+	using SoftBodyLODParameter = JoltSpaceSoftBodyLODParam;
+
+	using Capacity = JoltSpaceCapacity;
+
+	struct BodyIDHasher {
+		static uint32_t hash(const JPH::BodyID& p_id) {
+			return hash_fmix32(p_id.GetIndexAndSequenceNumber());
+		}
+	};
+
+	struct PooledBody {
+		JPH::BodyID id;
+
+		JPH::ObjectLayer object_layer = 0;
+	};
+
+	using QueryMutex = std::shared_mutex;
+
+	// Takes exclusive ownership of the query mutex for the duration of its scope, unless the
+	// calling thread already owns it, which lets modifications nest within one another.
+	class ModificationLock {
+	public:
+		explicit ModificationLock(JoltSpace3D& p_space);
+
+		~ModificationLock();
+
+		ModificationLock(const ModificationLock& p_other) = delete;
+
+		ModificationLock(ModificationLock&& p_other) = delete;
+
+		ModificationLock& operator=(const ModificationLock& p_other) = delete;
+
+		ModificationLock& operator=(ModificationLock&& p_other) = delete;
+
+	private:
+		JoltSpace3D* space = nullptr;
+	};
+
 public:
+	using QueryLock = std::shared_lock<QueryMutex>;
+
 	explicit JoltSpace3D(JPH::JobSystem* p_job_system);
 
 	~JoltSpace3D();
@@ -31,6 +75,71 @@ public:
 
 	void set_param(PhysicsServer3D::SpaceParameter p_param, double p_value);
 
+	Vector3 get_soft_body_lod_reference() const { return soft_body_lod_reference; }
+
+	void set_soft_body_lod_reference(const Vector3& p_position) {
+		soft_body_lod_reference = p_position;
+	}
+
+	double get_soft_body_lod_param(SoftBodyLODParameter p_param) const;
+
+	void set_soft_body_lod_param(SoftBodyLODParameter p_param, double p_value);
+
+	JoltSoftBodyLOD get_soft_body_lod(const JPH::AABox& p_bounds) const;
+
+	int32_t get_soft_body_lod_precision() const { return soft_body_lod_precision; }
+
+	bool is_soft_body_step_skipped(const JPH::BodyID& p_body_id) const;
+
+	bool is_contact_stream_enabled() const;
+
+	void set_contact_stream_enabled(bool p_enabled);
+
+	Dictionary get_contact_stream() const;
+
+	bool is_deterministic() const { return deterministic; }
+
+	void set_deterministic(bool p_enabled);
+
+	uint32_t get_state_hash() const { return state_hash; }
+
+	// Bodies that are moved without being activated won't show up among the active bodies at the
+	// end of the step, so they need to be reported here in order for the move to reach the hash.
+	void body_teleported(const JPH::BodyID& p_body_id);
+
+	Dictionary get_interpolated_transforms(float p_fraction);
+
+	void shift_origin(const Vector3& p_offset);
+
+	int64_t add_projectiles(
+		const PackedVector3Array& p_positions,
+		const PackedVector3Array& p_velocities,
+		float p_radius,
+		float p_gravity_scale,
+		float p_lifetime,
+		uint32_t p_collision_mask
+	);
+
+	void clear_projectiles();
+
+	Dictionary get_projectiles() const;
+
+	Dictionary get_projectile_hits() const;
+
+	int32_t get_max_pooled_bodies() const { return max_pooled_bodies; }
+
+	void set_max_pooled_bodies(int32_t p_count);
+
+	bool has_pooled_bodies() const { return !pooled_body_ids.is_empty(); }
+
+	bool is_body_pooled(const JPH::BodyID& p_body_id) const {
+		return pooled_body_ids.has(p_body_id);
+	}
+
+	int32_t get_capacity(Capacity p_capacity) const;
+
+	void set_capacity(Capacity p_capacity, int32_t p_value);
+
 	JPH::PhysicsSystem& get_physics_system() const { return *physics_system; }
 
 	JPH::BodyInterface& get_body_iface();
@@ -68,12 +177,16 @@ public:
 
 	JoltWritableBodies3D write_bodies(const JPH::BodyID* p_body_ids, int32_t p_body_count) const;
 
-	JoltPhysicsDirectSpaceState3DExtension* get_direct_state();
+	JoltPhysicsDirectSpaceState3DExtension* get_direct_state() const { return direct_state; }
 
 	JoltAreaImpl3D* get_default_area() const { return default_area; }
 
 	void set_default_area(JoltAreaImpl3D* p_area);
 
+	uint64_t get_area_overrides_version() const { return area_overrides_version; }
+
+	void area_overrides_changed() { area_overrides_version += 1; }
+
 	float get_last_step() const { return last_step; }
 
 	JPH::BodyID add_rigid_body(
@@ -86,10 +199,27 @@ public:
 		const JPH::SoftBodyCreationSettings& p_settings
 	);
 
-	void remove_body(const JPH::BodyID& p_body_id);
+	void add_pending_bodies();
+
+	void remove_body(const JPH::BodyID& p_body_id, bool p_poolable);
+
+	bool needs_optimizing() const {
+		return bodies_added_since_optimizing > 0 || !pending_bodies.is_empty() ||
+			broad_phase_layers_to_optimize > 0;
+	}
 
 	void try_optimize();
 
+	// Any number of threads can hold this lock at the same time, during which the space won't be
+	// stepped and no bodies will be added to or removed from it, making it safe to query.
+	QueryLock lock_for_query();
+
+	void optimize();
+
+	// Optimizes a single layer of the broad-phase, which only makes sense for spaces that aren't
+	// being stepped, since stepping optimizes it as well.
+	void optimize_incrementally();
+
 	void add_joint(JPH::Constraint* p_jolt_ref);
 
 	void add_joint(JoltJointImpl3D* p_joint);
@@ -98,6 +228,10 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint);
 
+	PackedByteArray save_state(const PackedByteArray& p_base);
+
+	bool restore_state(const PackedByteArray& p_state, const PackedByteArray& p_base);
+
 #ifdef GDJ_CONFIG_EDITOR
 	void dump_debug_snapshot(const String& p_dir);
 
@@ -115,8 +249,54 @@ private:
 
 	void _post_step(float p_step);
 
+	void _update_state_hash();
+
+	JPH::BodyID _try_reuse_pooled_body(const JPH::BodyCreationSettings& p_settings);
+
+	bool _try_pool_body(const JPH::BodyID& p_body_id);
+
+	void _release_pooled_bodies();
+
+	void _trim_pooled_bodies();
+
+	void _destroy_pooled_bodies();
+
+	JPH::PhysicsSystem* _create_physics_system() const;
+
+	bool _try_grow_max_bodies();
+
+	void _grow_capacities(JPH::EPhysicsUpdateError p_update_error);
+
+	bool _can_rebuild_physics_system() const { return !stepping && body_accessor.not_acquired(); }
+
+	void _add_pending_body(const JPH::BodyID& p_body_id);
+
+	void _remove_pending_body(const JPH::BodyID& p_body_id);
+
+	bool _should_try_optimize() const;
+
+	void _rebuild_physics_system();
+
+	void _capacity_changed();
+
 	JoltBodyWriter3D body_accessor;
 
+	QueryMutex query_mutex;
+
+	std::atomic<std::thread::id> modifying_thread;
+
+	LocalVector<JPH::BodyID> pending_bodies;
+
+	HashMap<JPH::BodyID, int32_t, BodyIDHasher> pending_body_indices;
+
+	LocalVector<JPH::BodyID> teleported_bodies;
+
+	HashMap<JPH::ObjectLayer, LocalVector<JPH::BodyID>> body_pool;
+
+	LocalVector<PooledBody> bodies_pooled_this_step;
+
+	HashSet<JPH::BodyID, BodyIDHasher> pooled_body_ids;
+
 	RID rid;
 
 	JPH::JobSystem* job_system = nullptr;
@@ -127,17 +307,57 @@ private:
 
 	JoltContactListener3D* contact_listener = nullptr;
 
+	JoltStateRecorder* state_recorder = nullptr;
+
+	JoltProjectileSystem3D* projectile_system = nullptr;
+
 	JPH::PhysicsSystem* physics_system = nullptr;
 
 	JoltPhysicsDirectSpaceState3DExtension* direct_state = nullptr;
 
 	JoltAreaImpl3D* default_area = nullptr;
 
+	Vector3 soft_body_lod_reference;
+
+	uint64_t step_count = 0;
+
+	uint64_t area_overrides_version = 0;
+
+	uint32_t state_hash = 0;
+
 	float last_step = 0.0f;
 
+	float soft_body_lod_reduce_distance = 0.0f;
+
+	float soft_body_lod_skip_distance = 0.0f;
+
+	float soft_body_lod_freeze_distance = 0.0f;
+
+	int32_t soft_body_lod_precision = 2;
+
+	// Soft bodies in the skip band don't make up for the steps they sit out, since they share the
+	// step size of every other body in the space, so they effectively run at 1/N of normal speed.
+	int32_t soft_body_lod_skip_interval = 4;
+
 	int32_t bodies_added_since_optimizing = 0;
 
+	int32_t broad_phase_layers_to_optimize = 0;
+
+	int32_t max_pooled_bodies = 0;
+
+	int32_t max_bodies = 0;
+
+	int32_t max_body_pairs = 0;
+
+	int32_t max_contact_constraints = 0;
+
 	bool active = false;
 
+	bool stepping = false;
+
+	bool rebuild_pending = false;
+
 	bool has_stepped = false;
+
+	bool deterministic = false;
 };
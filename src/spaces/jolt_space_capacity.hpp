@@ -0,0 +1,7 @@
+#pragma once
+
+enum JoltSpaceCapacity {
+	SPACE_CAPACITY_MAX_BODIES,
+	SPACE_CAPACITY_MAX_BODY_PAIRS,
+	SPACE_CAPACITY_MAX_CONTACT_CONSTRAINTS
+};
@@ -0,0 +1,207 @@
+#include "jolt_state_recorder.hpp"
+
+namespace {
+
+// Delta-encoded states are made up of runs, each consisting of a count of bytes that are identical
+// to the base state followed by a count of bytes that are not, with the latter stored inline. We
+// require a minimum number of identical bytes before ending a run, so as to not waste more space on
+// the run headers than we save by skipping the identical bytes.
+constexpr int32_t DELTA_MIN_MATCH = 8;
+
+template<typename TValue>
+void write_value(LocalVector<uint8_t>& p_buffer, const TValue& p_value) {
+	const int32_t offset = p_buffer.size();
+	p_buffer.resize(offset + (int32_t)sizeof(TValue));
+	memcpy(p_buffer.ptr() + offset, &p_value, sizeof(TValue));
+}
+
+template<typename TValue>
+bool read_value(const uint8_t* p_data, int32_t p_size, int32_t& p_offset, TValue& p_value) {
+	if (p_offset + (int32_t)sizeof(TValue) > p_size) {
+		return false;
+	}
+
+	memcpy(&p_value, p_data + p_offset, sizeof(TValue));
+	p_offset += (int32_t)sizeof(TValue);
+
+	return true;
+}
+
+} // namespace
+
+void JoltStateRecorder::WriteBytes(const void* p_data, size_t p_bytes) {
+	const int32_t offset = buffer.size();
+	buffer.resize(offset + (int32_t)p_bytes);
+	memcpy(buffer.ptr() + offset, p_data, p_bytes);
+}
+
+void JoltStateRecorder::ReadBytes(void* p_data, size_t p_bytes) {
+	if (read_offset + (int32_t)p_bytes > buffer.size()) {
+		memset(p_data, 0, p_bytes);
+		read_offset = buffer.size();
+		failed = true;
+		return;
+	}
+
+	memcpy(p_data, buffer.ptr() + read_offset, p_bytes);
+	read_offset += (int32_t)p_bytes;
+}
+
+void JoltStateRecorder::begin_writing() {
+	// Clearing the buffer keeps its capacity intact, meaning we only ever allocate when the state
+	// grows beyond what it has been before.
+	buffer.clear();
+	read_offset = 0;
+	failed = false;
+}
+
+void JoltStateRecorder::begin_reading() {
+	read_offset = 0;
+	failed = false;
+}
+
+PackedByteArray JoltStateRecorder::encode(const PackedByteArray& p_base) const {
+	const int32_t size = buffer.size();
+	const uint8_t* data = buffer.ptr();
+
+	PackedByteArray result;
+
+	if (p_base.is_empty()) {
+		result.resize(1 + size);
+
+		uint8_t* result_data = result.ptrw();
+		result_data[0] = FORMAT_FULL;
+		memcpy(result_data + 1, data, (size_t)size);
+
+		return result;
+	}
+
+	ERR_FAIL_COND_V_MSG(
+		p_base[0] != FORMAT_FULL,
+		result,
+		"Physics state can only be delta-encoded against a state that is not itself delta-encoded."
+	);
+
+	const uint8_t* base = p_base.ptr() + 1;
+	const auto base_size = (int32_t)p_base.size() - 1;
+
+	encode_buffer.clear();
+	write_value(encode_buffer, (uint8_t)FORMAT_DELTA);
+	write_value(encode_buffer, (uint32_t)size);
+
+	int32_t offset = 0;
+
+	while (offset < size) {
+		const int32_t match_start = offset;
+
+		while (offset < size && offset < base_size && data[offset] == base[offset]) {
+			offset += 1;
+		}
+
+		const int32_t literal_start = offset;
+
+		while (offset < size && !_is_match_start(base, base_size, offset)) {
+			offset += 1;
+		}
+
+		const int32_t literal_count = offset - literal_start;
+
+		write_value(encode_buffer, (uint32_t)(literal_start - match_start));
+		write_value(encode_buffer, (uint32_t)literal_count);
+
+		const int32_t literal_offset = encode_buffer.size();
+		encode_buffer.resize(literal_offset + literal_count);
+		memcpy(encode_buffer.ptr() + literal_offset, data + literal_start, (size_t)literal_count);
+	}
+
+	result.resize(encode_buffer.size());
+	memcpy(result.ptrw(), encode_buffer.ptr(), (size_t)encode_buffer.size());
+
+	return result;
+}
+
+bool JoltStateRecorder::decode(const PackedByteArray& p_state, const PackedByteArray& p_base) {
+	begin_writing();
+
+	ERR_FAIL_COND_V_MSG(p_state.is_empty(), false, "Physics state is empty.");
+
+	const uint8_t* data = p_state.ptr();
+	const auto size = (int32_t)p_state.size();
+
+	if (data[0] == FORMAT_FULL) {
+		WriteBytes(data + 1, (size_t)(size - 1));
+		return true;
+	}
+
+	ERR_FAIL_COND_V_MSG(
+		data[0] != FORMAT_DELTA,
+		false,
+		"Physics state is corrupt or was not created by this version of Godot Jolt."
+	);
+
+	ERR_FAIL_COND_V_MSG(
+		p_base.is_empty() || p_base[0] != FORMAT_FULL,
+		false,
+		"Physics state is delta-encoded, but no valid base state was provided."
+	);
+
+	const uint8_t* base = p_base.ptr() + 1;
+	const auto base_size = (int32_t)p_base.size() - 1;
+
+	int32_t offset = 1;
+	uint32_t decoded_size = 0;
+
+	bool valid = read_value(data, size, offset, decoded_size);
+
+	buffer.resize((int32_t)decoded_size);
+
+	int32_t decoded_offset = 0;
+
+	while (valid && decoded_offset < (int32_t)decoded_size) {
+		uint32_t match_count = 0;
+		uint32_t literal_count = 0;
+
+		valid = read_value(data, size, offset, match_count) &&
+			read_value(data, size, offset, literal_count);
+
+		const int64_t match_end = (int64_t)decoded_offset + match_count;
+		const int64_t literal_end = match_end + literal_count;
+
+		valid = valid && match_end <= base_size && literal_end <= decoded_size &&
+			offset + (int64_t)literal_count <= size;
+
+		if (valid) {
+			memcpy(buffer.ptr() + decoded_offset, base + decoded_offset, match_count);
+			decoded_offset += (int32_t)match_count;
+
+			memcpy(buffer.ptr() + decoded_offset, data + offset, literal_count);
+			decoded_offset += (int32_t)literal_count;
+			offset += (int32_t)literal_count;
+		}
+	}
+
+	ERR_FAIL_COND_V_MSG(
+		!valid,
+		false,
+		"Physics state is delta-encoded against a different base state, or is corrupt."
+	);
+
+	return true;
+}
+
+bool JoltStateRecorder::_is_match_start(
+	const uint8_t* p_base,
+	int32_t p_base_size,
+	int32_t p_offset
+) const {
+	const int32_t size = buffer.size();
+	const uint8_t* data = buffer.ptr();
+
+	for (int32_t i = p_offset; i < p_offset + DELTA_MIN_MATCH && i < size; ++i) {
+		if (i >= p_base_size || data[i] != p_base[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
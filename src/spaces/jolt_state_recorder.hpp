@@ -0,0 +1,36 @@
+#pragma once
+
+class JoltStateRecorder final : public JPH::StateRecorder {
+public:
+	void WriteBytes(const void* p_data, size_t p_bytes) override;
+
+	void ReadBytes(void* p_data, size_t p_bytes) override;
+
+	bool IsEOF() const override { return read_offset >= buffer.size(); }
+
+	bool IsFailed() const override { return failed; }
+
+	void begin_writing();
+
+	void begin_reading();
+
+	PackedByteArray encode(const PackedByteArray& p_base) const;
+
+	bool decode(const PackedByteArray& p_state, const PackedByteArray& p_base);
+
+private:
+	enum Format : uint8_t {
+		FORMAT_FULL,
+		FORMAT_DELTA
+	};
+
+	bool _is_match_start(const uint8_t* p_base, int32_t p_base_size, int32_t p_offset) const;
+
+	LocalVector<uint8_t> buffer;
+
+	mutable LocalVector<uint8_t> encode_buffer;
+
+	int32_t read_offset = 0;
+
+	bool failed = false;
+};